@@ -8,6 +8,14 @@
 
 namespace usf::internal {
 
+// Run time checks performed by the argument writers.
+enum class Checks : uint8_t
+{
+    kAll,       // Format spec errors, argument type / format spec match and buffer bounds
+    kBounds,    // Buffer bounds only (format spec validated at compile time)
+    kNone       // None (format spec validated and output size checked up front)
+};
+
 class ArgFormat
 {
     public:
@@ -23,6 +31,10 @@ class ArgFormat
         // PUBLIC DEFINITIONS
         // --------------------------------------------------------------------
 
+        // Maximum number of arguments: indices 0 to 254 are stored in a
+        // `uint8_t`, 255 stands for the next sequential argument.
+        static constexpr int kMaxArgs = 255;
+
         enum class Align : uint8_t
         {
             kNone    = (0U << 1U),
@@ -53,24 +65,352 @@ class ArgFormat
             kFloatScientific,
             kFloatGeneral,
             kString,
+            kDebug,
             kInvalid
         };
 
         // --------------------------------------------------------------------
         // PUBLIC MEMBER FUNCTIONS
         // --------------------------------------------------------------------
-       ArgFormat(usf::StringView& fmt, const int arg_count);
+
+        // Empty format spec ("{}") of the next sequential argument.
+        constexpr ArgFormat() noexcept = default;
+
+        // Parses the argument format spec at the beginning of `fmt` (placed
+        // at the "{" character) and removes it from `fmt`. The parse errors
+        // are reported by ec_error(). Constant expression, so format strings
+        // known at compile time can be parsed and validated at compile time.
+        // Argument names ("{name}") are resolved to the index of the same
+        // name in the `name_count` elements of `names`.
+        constexpr ArgFormat(usf::StringView& fmt, const int arg_count,
+                            const usf::StringView* const names = nullptr, const int name_count = 0) noexcept
+        {
+            const_iterator it = fmt.cbegin();
+
+            //USF_ENFORCE(*it == '{', std::runtime_error);
+            if( *it != '{') {
+                m_error = error::arg_enclose;
+                return;
+            }
+
+            // Iterator is placed at "{" character, so advance it.
+            ++it;
+
+            // Parse argument index
+            if(*it >= '0' && *it <= '9')
+            {
+                // Index limited to the last argument.
+                const auto ret = parse_positive_small_int(it, arg_count - 1);
+                if(ret<0) {
+                    m_error = (arg_count == 0) ? error::no_format_arg : error::arg_index_too_large;
+                    return;
+                }
+                m_index = static_cast<uint8_t>(ret);
+            }
+            else if((*it >= 'a' && *it <= 'z') || (*it >= 'A' && *it <= 'Z') || *it == '_')
+            {
+                // Parse argument name
+                const_iterator name = it;
+
+                while(it < fmt.cend() && ((*it >= 'a' && *it <= 'z') || (*it >= 'A' && *it <= 'Z')
+                                       || (*it >= '0' && *it <= '9') || *it == '_'))
+                {
+                    ++it;
+                }
+
+                const auto ret = find_name(usf::StringView(name, it), names, name_count);
+                if(ret<0) {
+                    m_error = error(ret);
+                    return;
+                }
+                m_index = static_cast<uint8_t>(ret);
+            }
+
+            if(*it == ':' && *(it + 1) != '}')
+            {
+                // A format spec is expected next...
+
+                //Remove the empty format flag
+                m_flags = Flags::kNone;
+
+                // Advance ':' character
+                ++it;
+
+                // Try to parse alignment flag at second character of format spec.
+                m_flags = parse_align_flag(*(it + 1));
+
+                if(m_flags != Flags::kNone)
+                {
+                    // Alignment flag present at second character of format spec.
+                    // Should also have a fill character at the first character.
+
+                    // The fill character can be any character except '{' or '}'.
+                    //USF_ENFORCE(*it != '{' && *it != '}', std::runtime_error);
+                    if(!(*it != '{' && *it != '}')) {
+                        m_error = error::arg_enclose;
+                        return;
+                    }
+                    m_fill_char = *it;
+                    it += 2;
+                }
+                else
+                {
+                    // Alignment flag not present at the second character of format spec.
+                    // Try to parse the alignment flag at the first character instead...
+                    m_flags = parse_align_flag(*it);
+
+                    if(m_flags != Flags::kNone)
+                    {
+                        ++it;
+                    }
+                }
+
+                // Parse sign flag
+                switch(*it)
+                {
+                    case '-': m_flags |= Flags::kSignMinus; ++it; break;
+                    case '+': m_flags |= Flags::kSignPlus;  ++it; break;
+                    case ' ': m_flags |= Flags::kSignSpace; ++it; break;
+                    default :                                     break;
+                }
+
+                // Parse hash flag
+                if(*it == '#')
+                {
+                    m_flags |= Flags::kHash;
+                    ++it;
+                }
+
+                bool fill_zero = false;
+
+                // Parse fill zero flag
+                if(*it == '0')
+                {
+                    fill_zero = true;
+                    ++it;
+                }
+
+                // Parse width
+                if(*it >= '0' && *it <= '9')
+                {
+                    // Limit width to 255 characters
+                    const auto ret = parse_positive_small_int(it, 255);
+                    if(ret<0) {
+                        m_error = error(ret);
+                        return;
+                    }
+                    m_width = static_cast<uint8_t>(ret);
+                }
+
+                // Parse grouping option
+                if(*it == ',' || *it == '_')
+                {
+                    m_group_char = *it++;
+                }
+
+                // Parse precision
+                if(*it == '.')
+                {
+                    ++it;
+
+                    // Check for a missing/invalid precision specifier.
+                    //USF_ENFORCE(*it >= '0' && *it <= '9', std::runtime_error);
+                    if(!(*it >= '0' && *it <= '9')) {
+                        m_error = error::inv_prec_specifier;
+                        return;
+                    }
+
+                    const auto ret = parse_positive_small_int(it, 127);
+                    if(ret<0) {
+                        m_error = error(ret);
+                        return;
+                    }
+                    m_precision = static_cast<int8_t>(ret);
+                }
+
+                // Parse type
+                if(*it != '}')
+                {
+                    switch(*it++)
+                    {
+                        case 'c': m_type = Type::kChar;            break;
+
+                        case 'd': m_type = Type::kIntegerDec;      break;
+
+                        case 'X': m_flags |= Flags::kUppercase;    [[fallthrough]];
+                        case 'x': m_type = Type::kIntegerHex;      break;
+
+                        case 'o': m_type = Type::kIntegerOct;      break;
+
+                        case 'B': m_flags |= Flags::kUppercase;    [[fallthrough]];
+                        case 'b': m_type = Type::kIntegerBin;      break;
+
+                        case 'P': m_flags |= Flags::kUppercase;    [[fallthrough]];
+                        case 'p': m_type = Type::kPointer;         break;
+
+                        case 'F': m_flags |= Flags::kUppercase;    [[fallthrough]];
+                        case 'f': m_type = Type::kFloatFixed;      break;
+
+                        case 'E': m_flags |= Flags::kUppercase;    [[fallthrough]];
+                        case 'e': m_type = Type::kFloatScientific; break;
+
+                        case 'G': m_flags |= Flags::kUppercase;    [[fallthrough]];
+                        case 'g': m_type = Type::kFloatGeneral;    break;
+
+                        case 's': m_type = Type::kString;          break;
+
+                        case '?': m_type = Type::kDebug;           break;
+
+                        default : m_type = Type::kInvalid;         break;
+                    }
+
+                    //USF_ENFORCE(m_type != Type::kInvalid, std::runtime_error);
+                    if(!(m_type != Type::kInvalid)) {
+                        m_error = error::inv_type;
+                        return;
+                    }
+                }
+
+                // Validate the read format spec!
+
+                if(fill_zero)
+                {
+                    // Fill zero flag has precedence over any other alignment and fill character.
+                    m_flags = static_cast<uint8_t>((m_flags & (~Flags::kAlignBitmask)) | Flags::kAlignNumeric);
+                    m_fill_char = '0';
+                }
+
+                if(align() == Align::kNumeric)
+                {
+                    // Numeric alignment are only valid for numeric and pointer types.
+                    //USF_ENFORCE(type_is_numeric() || type_is_pointer(), std::runtime_error);
+                    if(!(type_is_numeric() || type_is_pointer())) {
+                        m_error = error::inv_format;
+                        return;
+                    }
+                }
+
+                if(sign() != Sign::kNone)
+                {
+                    // Sign is only valid for numeric types.
+                    //USF_ENFORCE(type_is_numeric(), std::runtime_error);
+                    if(!(type_is_numeric())) {
+                        m_error = error::inv_sign;
+                        return;
+                    }
+                }
+
+                if(hash())
+                {
+                    // Alternative format is valid for hexadecimal (including
+                    // pointers), octal, binary and all floating point types.
+                    //USF_ENFORCE(type_allow_hash(), std::runtime_error);
+                    if(!(type_allow_hash())) {
+                        m_error = error::inv_format;
+                        return;
+                    }
+                }
+
+                if(grouping())
+                {
+                    // Digit grouping is only valid for decimal integer and fixed point types
+                    // (the type none is checked with the argument type), without zero padding
+                    // (the fill digits aren't grouped).
+                    //USF_ENFORCE((type_is_none() || type_is_integer_dec() || type_is_float_fixed()) && align() != Align::kNumeric, std::runtime_error);
+                    if(!(type_is_none() || type_is_integer_dec() || type_is_float_fixed()) || align() == Align::kNumeric) {
+                        m_error = error::inv_format;
+                        return;
+                    }
+                }
+
+                if(m_precision != -1)
+                {
+                    // Precision is only valid for floating point and string types.
+                    //USF_ENFORCE(type_is_float() || type_is_string() || type_is_debug(), std::runtime_error);
+                    if(!(type_is_float() || type_is_string() || type_is_debug())) {
+                        m_error = error::inv_format;
+                        return;
+                    }
+                }
+            }
+
+            // Test for unterminated argument format spec.
+            //USF_ENFORCE(it < fmt.cend() && *it++ == '}', std::runtime_error);
+            if(!(it < fmt.cend() && *it++ == '}')) {
+                m_error = error::arg_enclose;
+                return;
+            }
+            fmt.remove_prefix(it - fmt.cbegin());
+        }
 
         // Writes the alignment (sign, prefix and fill before) for any
         // argument type. Returns the fill counter to write after argument.
-        int write_alignment(iterator& it, const_iterator end,
-                                                int digits, const bool negative) const;
+        // The group separators of the `group_digits` integer digits (see
+        // group_separators()) are included in the field width. Returns -1
+        // if the field doesn't fit (not tested with Checks::kNone).
+        template <Checks kChecks = Checks::kAll>
+        constexpr int write_alignment(iterator& it, const_iterator end,
+                                      int digits, const bool negative,
+                                      const int group_digits = 0) const noexcept
+        {
+            digits += sign_width(negative) + prefix_width() + group_separators(group_digits);
+
+            int fill_after = 0;
+
+            if(width() <= digits)
+            {
+                //USF_ENFORCE(it + digits < end, std::runtime_error);
+                if(kChecks != Checks::kNone && it + digits >= end) {
+                    return -1;
+                }
+                write_sign(it, negative);
+                write_prefix(it);
+            }
+            else
+            {
+                //USF_ENFORCE(it + width() < end, std::runtime_error);
+                if(kChecks != Checks::kNone && it + width() >= end) {
+                    return -1;
+                }
+
+                int fill_count = width() - digits;
+
+                const Align al = align();
+
+                if(al == Align::kLeft)
+                {
+                    fill_after = fill_count;
+                }
+                else if(al == Align::kCenter)
+                {
+                    fill_after = fill_count - (fill_count / 2);
+                    fill_count /= 2;
+                }
+
+                if(al != Align::kLeft && al != Align::kNumeric)
+                {
+                    // None (default right), Right or Center alignment
+                    CharTraits::assign(it, fill_char(), fill_count);
+                }
+
+                write_sign(it, negative);
+                write_prefix(it);
+
+                if(al == Align::kNumeric)
+                {
+                    CharTraits::assign(it, fill_char(), fill_count);
+                }
+            }
+
+            return fill_after;
+        }
 
         inline constexpr CharType fill_char() const noexcept { return m_fill_char;                    }
+        inline constexpr CharType group_char() const noexcept { return m_group_char;                  }
         inline constexpr Type  type     () const noexcept { return m_type;                         }
         inline constexpr int   width    () const noexcept { return static_cast<int>(m_width    );  }
         inline constexpr int   precision() const noexcept { return static_cast<int>(m_precision);  }
-        inline constexpr int   index    () const noexcept { return static_cast<int>(m_index    );  }
+        inline constexpr int   index    () const noexcept { return (m_index == kNoIndex) ? -1 : static_cast<int>(m_index); }
 
         inline constexpr Align align() const noexcept { return Align(m_flags & Flags::kAlignBitmask); }
         inline constexpr Sign  sign () const noexcept { return Sign (m_flags & Flags::kSignBitmask ); }
@@ -78,10 +418,12 @@ class ArgFormat
         inline constexpr bool  is_empty () const noexcept { return (m_flags & Flags::kEmpty    ) != 0; }
         inline constexpr bool  hash     () const noexcept { return (m_flags & Flags::kHash     ) != 0; }
         inline constexpr bool  uppercase() const noexcept { return (m_flags & Flags::kUppercase) != 0; }
+        inline constexpr bool  grouping () const noexcept { return m_group_char != '\0';              }
 
         inline constexpr bool type_is_none   () const noexcept { return m_type == Type::kNone;    }
         inline constexpr bool type_is_char   () const noexcept { return m_type == Type::kChar;    }
         inline constexpr bool type_is_string () const noexcept { return m_type == Type::kString;  }
+        inline constexpr bool type_is_debug  () const noexcept { return m_type == Type::kDebug;   }
         inline constexpr bool type_is_pointer() const noexcept { return m_type == Type::kPointer; }
 
         inline constexpr bool type_is_integer() const noexcept { return m_type >= Type::kIntegerDec && m_type <= Type::kIntegerBin;   }
@@ -104,6 +446,40 @@ class ArgFormat
             return m_type >= Type::kIntegerHex && m_type <= Type::kFloatGeneral;
         }
 
+        // Returns the number of digits needed to fill the field width when
+        // zero padding is used (e.g. "{:08x}"), or `digits` otherwise. This
+        // allows the converters to write the leading zeros themselves.
+        inline constexpr int padded_digits(const int digits, const bool negative) const noexcept
+        {
+            if(align() != Align::kNumeric || m_fill_char != '0') { return digits; }
+
+            const int padded = width() - sign_width(negative) - prefix_width();
+
+            return (padded > digits) ? padded : digits;
+        }
+
+        // Returns the number of group separators ("{:,}" or "{:_}") to insert
+        // in an integer part of `digits` digits, one every 3 digits.
+        inline constexpr int group_separators(const int digits) const noexcept
+        {
+            // ((digits - 1) * 43) >> 7 == (digits - 1) / 3 for up to 126 digits
+            // (avoids a division instruction when optimizing for size).
+            return (grouping() && digits > 1) ? ((digits - 1) * 43) >> 7 : 0;
+        }
+
+        // Number of sign characters written for a `negative` or positive value.
+        inline constexpr int sign_width(const bool negative) const noexcept
+        {
+            return (!negative && sign() <= Sign::kMinus) ? 0 : 1;
+        }
+
+        inline constexpr int prefix_width() const noexcept
+        {
+            // Alternative format is valid for hexadecimal (including
+            // pointers), octal, binary and all floating point types.
+            return (!hash() || type_is_float()) ? 0 : type_is_integer_oct() ? 1 : 2;
+        }
+
         inline constexpr void default_align_left() noexcept
         {
             if((m_flags & Flags::kAlignBitmask) == Flags::kAlignNone)
@@ -116,6 +492,15 @@ class ArgFormat
             return m_error;
         }
 
+        // Returns true if `other` formats an argument the same way (argument
+        // index aside), so both write the same output for the same argument.
+        inline constexpr bool same_spec(const ArgFormat& other) const noexcept
+        {
+            return m_fill_char == other.m_fill_char && m_group_char == other.m_group_char
+                && m_type == other.m_type && m_flags == other.m_flags
+                && m_width == other.m_width && m_precision == other.m_precision;
+        }
+
     private:
 
         // --------------------------------------------------------------------
@@ -150,47 +535,126 @@ class ArgFormat
         // PRIVATE MEMBER FUNCTIONS
         // --------------------------------------------------------------------
 
-        inline constexpr int sign_width(const bool negative) const noexcept
+        constexpr void write_sign(iterator& it, const bool negative) const noexcept
         {
-            return (!negative && sign() <= Sign::kMinus) ? 0 : 1;
+            if(negative)
+            {
+                *it++ = '-';
+            }
+            else
+            {
+                const Sign s = sign();
+
+                if(s == Sign::kPlus)
+                {
+                    *it++ = '+';
+                }
+                else if(s == Sign::kSpace)
+                {
+                    *it++ = ' ';
+                }
+            }
         }
 
-        inline constexpr int prefix_width() const noexcept
+        constexpr void write_prefix(iterator& it) const noexcept
         {
             // Alternative format is valid for hexadecimal (including
             // pointers), octal, binary and all floating point types.
-            return (!hash() || type_is_float()) ? 0 : type_is_integer_oct() ? 1 : 2;
+            if(hash() && !type_is_float())
+            {
+                *it++ = '0';
+
+                if(type_is_integer_bin())
+                {
+                    *it++ = uppercase() ? 'B' : 'b';
+                }
+                else if(type_is_integer_hex() || type_is_pointer())
+                {
+                    *it++ = uppercase() ? 'X' : 'x';
+                }
+            }
         }
 
-        void write_sign(iterator& it, const bool negative) const noexcept;
-       
-
-        void write_prefix(iterator& it) const noexcept;
-
         // --------------------------------------------------------------------
         // PRIVATE STATIC FUNCTIONS
         // --------------------------------------------------------------------
 
+        // Returns the index of `name` in the `count` elements of `names`, or
+        // error::arg_name if not found.
+        static constexpr int find_name(const usf::StringView name, const usf::StringView* const names,
+                                       const int count) noexcept
+        {
+            for(int n = 0; n < count; ++n)
+            {
+                const usf::StringView candidate = names[n];
+
+                if(candidate.size() == name.size())
+                {
+                    std::ptrdiff_t i = 0;
+
+                    while(i < name.size() && candidate[i] == name[i]) { ++i; }
+
+                    if(i == name.size()) { return n; }
+                }
+            }
+            return int(error::arg_name);
+        }
+
+        static constexpr uint8_t kNoIndex = 0xFF;
+
         // Parses the input as a positive integer that fits into a `uint8_t` type. This
         // function assumes that the first character is a digit and terminates parsing
         // at the presence of the first non-digit character or when value overflows.
-        static 
-        int parse_positive_small_int(const_iterator& it, const int max_value);
+        static constexpr int parse_positive_small_int(const_iterator& it, const int max_value) noexcept
+        {
+            assert(max_value < 256);
 
-        static uint8_t parse_align_flag(const CharType ch) noexcept;
+            int value = 0;
+
+            do
+            {
+                value = value * 10 + (*it++ - '0');
+
+                // Check for overflow
+                //USF_ENFORCE(value <= max_value, std::runtime_error);
+                if(!(value <= max_value)) {
+                    return int(error::value_overflow);
+                }
+            }while(*it >= '0' && *it <= '9');
+
+            return value;
+        }
+
+        static constexpr uint8_t parse_align_flag(const CharType ch) noexcept
+        {
+            switch(ch)
+            {
+                case '<': return Flags::kAlignLeft;
+                case '>': return Flags::kAlignRight;
+                case '^': return Flags::kAlignCenter;
+                case '=': return Flags::kAlignNumeric;
+                default : return Flags::kNone;
+            }
+        }
 
         // --------------------------------------------------------------------
         // PRIVATE MEMBER VARIABLES
         // --------------------------------------------------------------------
 
         CharType   m_fill_char = ' ';
+        CharType   m_group_char = '\0';
         Type    m_type     = Type::kNone;
         uint8_t m_flags    = Flags::kEmpty;
         uint8_t m_width    =  0;
         int8_t m_precision = -1;
-        int8_t m_index     = -1;
-        mutable error m_error      = error::success;
+        uint8_t m_index    = kNoIndex;
+        error   m_error    = error::success;
 };
 
+// Run time alignment writers, instantiated in arg_format.cpp
+extern template int ArgFormat::write_alignment<Checks::kAll   >(iterator&, const_iterator, int, const bool, const int) const noexcept;
+extern template int ArgFormat::write_alignment<Checks::kBounds>(iterator&, const_iterator, int, const bool, const int) const noexcept;
+extern template int ArgFormat::write_alignment<Checks::kNone  >(iterator&, const_iterator, int, const bool, const int) const noexcept;
+
 } // namespace usf
 
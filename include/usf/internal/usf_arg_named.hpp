@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// @file    usf_arg_named.hpp
+// @brief   Named arguments, referenced by name in the format string
+//          ("{host}:{port}" or "{port:>5}").
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf
+{
+
+// Argument named at run time. Use usf::arg() to create it. Names are
+// resolved to argument indices at each call (see usf::resolve_arg_names()
+// to resolve the names of a format string once).
+template <typename T>
+struct NamedArg
+{
+    StringView name;
+    const T&   value;
+};
+
+// Argument named at compile time. Use usf::arg(USF_FMT("name"), value) or,
+// with C++20, usf::arg<"name">(value). Names are resolved to argument
+// indices at compile time by the compile-time format strings.
+template <typename Name, typename T>
+struct StaticNamedArg
+{
+    const T& value;
+};
+
+template <typename T> inline constexpr
+NamedArg<T> arg(const StringView name, const T& value) noexcept
+{
+    return NamedArg<T>{name, value};
+}
+
+template <typename Name, typename T,
+          typename std::enable_if<internal::is_compile_string<Name>::value, bool>::type = true>
+inline constexpr
+StaticNamedArg<Name, T> arg(Name, const T& value) noexcept
+{
+    return StaticNamedArg<Name, T>{value};
+}
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+template <internal::FixedString kName, typename T> inline constexpr
+StaticNamedArg<internal::FixedCompileString<kName>, T> arg(const T& value) noexcept
+{
+    return StaticNamedArg<internal::FixedCompileString<kName>, T>{value};
+}
+#endif
+
+namespace internal
+{
+
+// Named argument properties: the type of the value and the name known at
+// compile time (empty if none).
+template <typename T>
+struct ArgTraits
+{
+    using ValueType = T;
+
+    static constexpr bool kNamed = false;
+
+    static constexpr StringView static_name() noexcept { return StringView(""); }
+};
+
+template <typename T>
+struct ArgTraits<NamedArg<T>>
+{
+    using ValueType = T;
+
+    static constexpr bool kNamed = true;
+
+    static constexpr StringView static_name() noexcept { return StringView(""); }
+};
+
+template <typename Name, typename T>
+struct ArgTraits<StaticNamedArg<Name, T>>
+{
+    using ValueType = T;
+
+    static constexpr bool kNamed = true;
+
+    static constexpr StringView static_name() noexcept { return Name::view(); }
+};
+
+template <typename T> inline constexpr
+StringView arg_name(const T&) noexcept
+{
+    return ArgTraits<T>::static_name();
+}
+
+template <typename T> inline constexpr
+StringView arg_name(const NamedArg<T>& arg) noexcept
+{
+    return arg.name;
+}
+
+template <typename T> inline constexpr
+const T& arg_value(const T& arg) noexcept
+{
+    return arg;
+}
+
+template <typename T> inline constexpr
+const T& arg_value(const NamedArg<T>& arg) noexcept
+{
+    return arg.value;
+}
+
+template <typename Name, typename T> inline constexpr
+const T& arg_value(const StaticNamedArg<Name, T>& arg) noexcept
+{
+    return arg.value;
+}
+
+} // namespace internal
+} // namespace usf
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// @file    usf_arg_range.hpp
+// @brief   Range argument types (arrays and byte buffers formatted as a
+//          single argument).
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf
+{
+
+// Array of integers formatted as decimal values separated by `separator`.
+// Use usf::join() to create it. Only the (whole) width, fill and alignment
+// format options are applied, e.g. "{:>40}" or "{:d}".
+struct IntegerRange
+{
+    const uint32_t* data;
+    std::ptrdiff_t  size;
+    StringView      separator;
+};
+
+inline constexpr
+IntegerRange join(const uint32_t* const data, const std::ptrdiff_t size,
+                  const StringView separator = ", ") noexcept
+{
+    return IntegerRange{data, size, separator};
+}
+
+template <std::size_t N> inline constexpr
+IntegerRange join(const std::array<uint32_t, N>& array, const StringView separator = ", ") noexcept
+{
+    return IntegerRange{array.data(), static_cast<std::ptrdiff_t>(N), separator};
+}
+
+// Byte buffer formatted as hexadecimal text. Use usf::bytes() to create it
+// as continuous ("{:x}" / "{:X}", e.g. "deadbeef") or separated (e.g.
+// "de:ad:be:ef") hexadecimal, or usf::hexdump() for a multi-line layout
+// with offset and ASCII columns. usf::base64() encodes the buffer as base64
+// text ("{}" / "{:s}").
+struct ByteRange
+{
+    enum class Layout : uint8_t
+    {
+        kHex,
+        kHexDump,
+        kBase64
+    };
+
+    const uint8_t*  data;
+    std::ptrdiff_t  size;
+    StringView      separator;
+    Layout          layout;
+};
+
+inline
+ByteRange bytes(const void* const data, const std::ptrdiff_t size, const StringView separator = "") noexcept
+{
+    return ByteRange{static_cast<const uint8_t*>(data), size, separator, ByteRange::Layout::kHex};
+}
+
+inline
+ByteRange hexdump(const void* const data, const std::ptrdiff_t size) noexcept
+{
+    return ByteRange{static_cast<const uint8_t*>(data), size, "", ByteRange::Layout::kHexDump};
+}
+
+inline
+ByteRange base64(const void* const data, const std::ptrdiff_t size) noexcept
+{
+    return ByteRange{static_cast<const uint8_t*>(data), size, "", ByteRange::Layout::kBase64};
+}
+
+} // namespace usf
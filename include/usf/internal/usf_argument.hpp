@@ -46,6 +46,16 @@ class Argument
 
         constexpr Argument(const uint64_t value) noexcept
             : m_uint64(value), m_type_id(TypeId::kUint64) {}
+
+#if defined(USF_INT128_SUPPORT)
+        // 128 bit values are referenced (as the ranges) to keep the size of
+        // the argument array unchanged.
+        constexpr Argument(const int128_t& value) noexcept
+            : m_int128(&value), m_type_id(TypeId::kInt128) {}
+
+        constexpr Argument(const uint128_t& value) noexcept
+            : m_uint128(&value), m_type_id(TypeId::kUint128) {}
+#endif
     
         Argument(const void* value) noexcept
             : m_pointer(reinterpret_cast<std::uintptr_t>(value)), m_type_id(TypeId::kPointer) {}
@@ -60,22 +70,46 @@ class Argument
         constexpr Argument(const ArgCustomType value) noexcept
             : m_custom(value), m_type_id(TypeId::kCustom) {}
 
+        constexpr Argument(const IntegerRange& value) noexcept
+            : m_integer_range(&value), m_type_id(TypeId::kIntegerRange) {}
+
+        constexpr Argument(const ByteRange& value) noexcept
+            : m_byte_range(&value), m_type_id(TypeId::kByteRange) {}
+
+        template <Checks kChecks = Checks::kAll>
         [[nodiscard]] error format(usf::StringSpan& dst, ArgFormat& format) const;
 
+        // Size of a string argument (only valid for strings).
+        constexpr std::ptrdiff_t string_size() const noexcept { return m_string.size(); }
+
     private:
 
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        inline constexpr bool is_numeric() const noexcept
+        {
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+            if(m_type_id == TypeId::kFloat) { return true; }
+#endif
+            return m_type_id >= TypeId::kInt32 && m_type_id < TypeId::kPointer;
+        }
+
         // --------------------------------------------------------------------
         // PRIVATE STATIC FUNCTIONS
         // --------------------------------------------------------------------
 
+        template <Checks kChecks>
         static error format_bool(iterator& it, const_iterator end,
                                                     const ArgFormat& format, const bool value);
       
+        template <Checks kChecks>
         static error format_char(iterator& it, const_iterator end,
                                                     ArgFormat& format, const CharType value);
      
 
-        template <typename T, typename std::enable_if<std::is_signed<T>::value, bool>::type = true>
+        template <Checks kChecks, typename T, typename std::enable_if<std::is_signed<T>::value, bool>::type = true>
         static error format_integer(iterator& it, const_iterator end,
                                                        const ArgFormat& format, const T value)
         {
@@ -84,50 +118,79 @@ class Argument
             const bool negative = (value < 0);
             const auto uvalue = static_cast<unsigned_type>(negative ? -value : value);
 
-            return format_integer(it, end, format, uvalue, negative);
+            return format_integer<kChecks>(it, end, format, uvalue, negative);
         }
 
-        template <typename T, typename std::enable_if<std::is_unsigned<T>::value, bool>::type = true>
+#if defined(USF_INT128_SUPPORT)
+        template <Checks kChecks>
+        static error format_integer(iterator& it, const_iterator end,
+                                                       const ArgFormat& format, const int128_t value)
+        {
+            const bool negative = (value < 0);
+            const auto uvalue = negative ? -static_cast<uint128_t>(value) : static_cast<uint128_t>(value);
+
+            return format_integer<kChecks>(it, end, format, uvalue, negative);
+        }
+#endif
+
+        template <Checks kChecks, typename T, typename std::enable_if<Integer::is_unsigned<T>::value, bool>::type = true>
         static error format_integer(iterator& it, const_iterator end, const ArgFormat& format,
                                                        const T value, const bool negative = false)
         {
+            // Maximum number of digits of the fixed digit converters
+            constexpr bool wide = (sizeof(T) > sizeof(uint64_t));
+            constexpr int max_hex = wide ? 32 :  16;
+            constexpr int max_oct = wide ? 43 :  22;
+            constexpr int max_bin = wide ? 128 : 64;
+
             int fill_after = 0;
 
             if(format.type_is_none() || format.type_is_integer_dec())
             {
                 const auto digits = Integer::count_digits_dec(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
+                fill_after = format.write_alignment<kChecks>(it, end, digits, negative, digits);
                 if(fill_after<0)
                     return error::buf_overflow;
-                it += digits;
-                Integer::convert_dec(it, value);
+                if(format.grouping())
+                {
+                    it += digits + format.group_separators(digits);
+                    Integer::convert_dec(it, value, format.group_char());
+                }
+                else
+                {
+                    it += digits;
+                    Integer::convert_dec(it, value);
+                }
             }
+            // The leading zeros of zero padded hexadecimal, octal and binary
+            // fields are written by the converters.
             else if(format.type_is_integer_hex())
             {
-                const auto digits = Integer::count_digits_hex(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
+                const auto digits = std::min(format.padded_digits(Integer::count_digits_hex(value), negative), max_hex);
+                fill_after = format.write_alignment<kChecks>(it, end, digits, negative);
                 if(fill_after<0)
                     return error::buf_overflow;
                 it += digits;
-                Integer::convert_hex(it, value, format.uppercase());
+                Integer::convert_hex(it, value, format.uppercase(), digits);
             }
             else if(format.type_is_integer_oct())
             {
-                const auto digits = Integer::count_digits_oct(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
+                const auto digits = std::min(format.padded_digits(Integer::count_digits_oct(value), negative), max_oct);
+                fill_after = format.write_alignment<kChecks>(it, end, digits, negative);
                 if(fill_after<0)
                     return error::buf_overflow;
                 it += digits;
-                Integer::convert_oct(it, value);
+                Integer::convert_oct(it, value, digits);
             }
-            else if(format.type_is_integer_bin())
+            // Binary is the only type left once validated at compile time
+            else if(kChecks != Checks::kAll || format.type_is_integer_bin())
             {
-                const auto digits = Integer::count_digits_bin(value);
-                fill_after = format.write_alignment(it, end, digits, negative);
+                const auto digits = std::min(format.padded_digits(Integer::count_digits_bin(value), negative), max_bin);
+                fill_after = format.write_alignment<kChecks>(it, end, digits, negative);
                 if(fill_after<0)
                     return error::buf_overflow;
                 it += digits;
-                Integer::convert_bin(it, value);
+                Integer::convert_bin(it, value, digits);
             }
             else
             {
@@ -141,32 +204,44 @@ class Argument
         }
 
 
-        error format_pointer(iterator& it, const_iterator end,
-                                                       const ArgFormat& format, const std::uintptr_t value) const;
+        template <Checks kChecks>
+        static error format_pointer(iterator& it, const_iterator end,
+                                                       const ArgFormat& format, const std::uintptr_t value);
 
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        template <Checks kChecks>
         static 
         error format_float(iterator& it, const_iterator end, const ArgFormat& format, double value) ;
 
         static 
         void write_float_exponent(iterator& it, int exponent, const bool uppercase) noexcept ;
 
+        template <Checks kChecks>
         static 
-        void format_float_zero(iterator& it, const_iterator end, const ArgFormat& format, const bool negative);
+        error format_float_zero(iterator& it, const_iterator end, const ArgFormat& format, const bool negative);
 
 #endif // !defined(USF_DISABLE_FLOAT_SUPPORT)
 
-        error format_string(iterator& it, const_iterator end,
-                                                      ArgFormat& format, const usf::StringView& str) const;
+        template <Checks kChecks>
+        static error format_string(iterator& it, const_iterator end,
+                                                      ArgFormat& format, const usf::StringView& str);
+
+        template <Checks kChecks>
+        static error format_integer_range(iterator& it, const_iterator end,
+                                          const ArgFormat& format, const IntegerRange& range);
+
+        template <Checks kChecks>
+        static error format_byte_range(iterator& it, const_iterator end,
+                                       const ArgFormat& format, const ByteRange& range);
        
         
-        template <typename CharSrc,
+        template <Checks kChecks, typename CharSrc,
                   typename std::enable_if<std::is_convertible<CharSrc, CharType>::value, bool>::type = true>
         static error format_string(iterator& it, const_iterator end,
                                                       const ArgFormat& format, const CharSrc* str,
                                                       const int str_length, const bool negative = false)
         {
-            const int fill_after = format.write_alignment(it, end, str_length, negative);
+            const int fill_after = format.write_alignment<kChecks>(it, end, str_length, negative);
             if(fill_after<0)
                 return error::buf_overflow;
 
@@ -187,12 +262,18 @@ class Argument
             kUint32,
             kInt64,
             kUint64,
+#if defined(USF_INT128_SUPPORT)
+            kInt128,
+            kUint128,
+#endif
             kPointer,
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
             kFloat,
 #endif
             kString,
-            kCustom
+            kCustom,
+            kIntegerRange,
+            kByteRange
         };
 
         union
@@ -203,12 +284,18 @@ class Argument
             uint32_t                        m_uint32;
             int64_t                         m_int64;
             uint64_t                        m_uint64;
+#if defined(USF_INT128_SUPPORT)
+            const int128_t*                 m_int128;
+            const uint128_t*                m_uint128;
+#endif
             std::uintptr_t                  m_pointer;
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
             double                          m_float;
 #endif
             usf::StringView                 m_string;
             ArgCustomType                   m_custom;
+            const IntegerRange*             m_integer_range;
+            const ByteRange*                m_byte_range;
         };
 
         TypeId                              m_type_id;
@@ -343,6 +430,33 @@ Argument make_argument(const uint64_t arg)
     return arg;
 }
 
+#if defined(USF_INT128_SUPPORT)
+// 128 bit signed integer
+inline constexpr
+Argument make_argument(const int128_t& arg)
+{
+    if(arg >= std::numeric_limits<int64_t>::min()
+    && arg <= std::numeric_limits<int64_t>::max())
+    {
+        return make_argument(static_cast<int64_t>(arg));
+    }
+
+    return arg;
+}
+
+// 128 bit unsigned integer
+inline constexpr
+Argument make_argument(const uint128_t& arg)
+{
+    if(arg <= std::numeric_limits<uint64_t>::max())
+    {
+        return make_argument(static_cast<uint64_t>(arg));
+    }
+
+    return arg;
+}
+#endif // defined(USF_INT128_SUPPORT)
+
 // Pointer (void*)
 inline
 Argument make_argument(void* arg)
@@ -373,6 +487,20 @@ Argument make_argument(double arg)
 }
 #endif // !defined(USF_DISABLE_FLOAT_SUPPORT)
 
+// Integer range (usf::join)
+inline constexpr
+Argument make_argument(const IntegerRange& arg)
+{
+    return arg;
+}
+
+// Byte range (usf::bytes, usf::hexdump, usf::base64)
+inline constexpr
+Argument make_argument(const ByteRange& arg)
+{
+    return arg;
+}
+
 // String (convertible to string view)
 template <typename T,
           typename std::enable_if<std::is_convertible<T, usf::StringView>::value, bool>::type = true>
@@ -404,6 +532,19 @@ inline Argument make_argument(const T& arg)
     return ArgCustomType::template create<_T, &usf::Formatter<_T>::format_to>(&arg);
 }
 
+// Named argument (usf::arg)
+template <typename T>
+inline Argument make_argument(const NamedArg<T>& arg)
+{
+    return make_argument(arg.value);
+}
+
+template <typename Name, typename T>
+inline Argument make_argument(const StaticNamedArg<Name, T>& arg)
+{
+    return make_argument(arg.value);
+}
+
 } // namespace internal
 } // namespace usf
 
@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------
+// @file    usf_compile_string.hpp
+// @brief   Strings known at compile time (format strings and argument names).
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf::internal
+{
+
+// Base class of the format strings known at compile time. Derived classes
+// provide a `static constexpr StringView view()` function (see USF_FMT()).
+struct CompileString {};
+
+template <typename T>
+struct is_compile_string : std::is_base_of<CompileString, T> {};
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+// String literal usable as a template argument (C++20)
+template <std::size_t N>
+struct FixedString
+{
+    constexpr FixedString(const CharType (&str)[N]) noexcept
+    {
+        for(std::size_t n = 0; n < N; ++n) { data[n] = str[n]; }
+    }
+
+    CharType data[N]{};
+};
+
+template <FixedString kStr>
+struct FixedCompileString : CompileString
+{
+    static constexpr StringView view() noexcept
+    {
+        return StringView(kStr.data, static_cast<std::ptrdiff_t>(sizeof(kStr.data) - 1));
+    }
+};
+#endif // defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+
+} // namespace usf::internal
+
+// Format string known at compile time, e.g. usf::format_to(str, 32, USF_FMT("{:x}"), 42).
+// The format string is parsed and validated against the argument types at
+// compile time: errors and argument / format spec mismatches are build errors.
+// Also used for argument names known at compile time: usf::arg(USF_FMT("host"), host).
+#define USF_FMT(str)                                                             \
+    ([]() noexcept                                                               \
+    {                                                                            \
+        struct UsfCompileString : usf::internal::CompileString                   \
+        {                                                                        \
+            static constexpr usf::StringView view() noexcept { return str; }     \
+        };                                                                       \
+        return UsfCompileString{};                                               \
+    }())
@@ -34,6 +34,12 @@
 // USF_ABORT_ON_CONTRACT_VIOLATION     : std::abort() will be called (more suitable for embedded platforms, maybe?)
 // USF_THROW_ON_CONTRACT_VIOLATION     : an exception will be thrown
 
+// Configuration of 128 bit integer support (GCC / Clang on 64 bit targets).
+// USF_DISABLE_INT128_SUPPORT          : disables the support of the usf::int128_t / usf::uint128_t types
+
+// Configuration of vectorized conversion kernels.
+// USF_DISABLE_SIMD_SUPPORT            : disables the SIMD / SWAR conversion kernels (plain scalar loops only)
+
 
 // ----------------------------------------------------------------------------
 // Compiler version detection
@@ -58,6 +64,68 @@
 #endif
 
 
+#if defined(USF_COMPILER_GCC) || defined(USF_COMPILER_CLANG)
+#  define USF_ALWAYS_INLINE  inline __attribute__((always_inline))
+#else
+#  define USF_ALWAYS_INLINE  inline
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Target detection
+// ----------------------------------------------------------------------------
+
+#if defined(__LP64__) || defined(_WIN64) || (defined(__SIZEOF_POINTER__) && (__SIZEOF_POINTER__ == 8))
+#  define USF_TARGET_64_BITS
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#  define USF_TARGET_LITTLE_ENDIAN
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Language features
+// ----------------------------------------------------------------------------
+
+// Class type non-type template parameters (C++20), for format strings passed
+// as template arguments: usf::format_to<"{:x}">(...)
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+#  define USF_CPP20_STRING_TEMPLATE_ARGS
+#endif
+
+
+// ----------------------------------------------------------------------------
+// 128 bit integers
+// ----------------------------------------------------------------------------
+
+#if defined(__SIZEOF_INT128__) && !defined(USF_DISABLE_INT128_SUPPORT)
+#  define USF_INT128_SUPPORT
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Vectorized conversion kernels
+// ----------------------------------------------------------------------------
+// USF_SIMD_SSE2 : SSE2 kernels (baseline of every x86-64 target)
+// USF_SIMD_SSSE3: SSSE3 byte shuffle kernels (e.g. -mssse3 or -march=native)
+// USF_SWAR64    : portable 64 bit "SIMD within a register" kernels, available
+//                 on little endian 64 bit targets (e.g. x86-64 and AArch64)
+// The kernels are selected at compile time, there is no runtime dispatch.
+
+#if !defined(USF_DISABLE_SIMD_SUPPORT)
+#  if defined(__SSE2__) || defined(_M_X64)
+#    define USF_SIMD_SSE2
+#  endif
+#  if defined(__SSSE3__)
+#    define USF_SIMD_SSSE3
+#  endif
+#  if defined(USF_TARGET_64_BITS) && defined(USF_TARGET_LITTLE_ENDIAN)
+#    define USF_SWAR64
+#  endif
+#endif
+
+
 // ----------------------------------------------------------------------------
 // Error handling
 // ----------------------------------------------------------------------------
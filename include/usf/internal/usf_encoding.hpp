@@ -0,0 +1,43 @@
+// ----------------------------------------------------------------------------
+// @file    usf_encoding.hpp
+// @brief   Byte buffer encoding functions (hexadecimal, hex dump, base64)
+//          and string escaping.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+#include <cstdint>
+
+namespace usf::internal::Encoding
+{
+    // Unlike the integer converters, the following functions write the
+    // output front to back, starting at `dst`. The output size must be
+    // calculated beforehand with the corresponding xxx_size() function.
+
+    // Continuous hexadecimal ("deadbeef") or separated by `separator` ("de:ad:be:ef").
+    std::ptrdiff_t hex_size(std::ptrdiff_t size, const StringView& separator) noexcept;
+
+    void convert_hex(CharType* dst, const uint8_t* src, std::ptrdiff_t size,
+                     const StringView& separator, const bool uppercase) noexcept;
+
+    // Multi-line `hexdump -C` like layout, 16 bytes per line (no trailing new line):
+    // 00000000  48 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a 00 01  |Hello, world!...|
+    std::ptrdiff_t hexdump_size(std::ptrdiff_t size) noexcept;
+
+    void convert_hexdump(CharType* dst, const uint8_t* src, std::ptrdiff_t size,
+                         const bool uppercase) noexcept;
+
+    // Standard base64 alphabet (RFC 4648) with '=' padding.
+    std::ptrdiff_t base64_size(std::ptrdiff_t size) noexcept;
+
+    void convert_base64(CharType* dst, const uint8_t* src, std::ptrdiff_t size) noexcept;
+
+    // JSON string escaping, with the C escapes where they exist: '"', '\\'
+    // and \b \f \n \r \t in two characters, the other control characters
+    // (and DEL) as \u00XX. Everything else, UTF-8 included, is copied. The
+    // surrounding quotes are not written.
+    std::ptrdiff_t escaped_size(const CharType* src, std::ptrdiff_t size) noexcept;
+
+    void convert_escaped(CharType* dst, const CharType* src, std::ptrdiff_t size) noexcept;
+
+} // namespace usf::internal::Encoding
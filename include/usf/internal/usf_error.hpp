@@ -15,7 +15,11 @@ namespace usf {
         inv_type            = -10,
         inv_sign            = -11,
         inv_format          = -12,
+        arg_name            = -13,
         value_overflow      = -14,
+        io_error            = -15,
+        backpressure        = -16,
+        no_match            = -17,
     };
 
     [[nodiscard]] const char* error_to_string(error ec);
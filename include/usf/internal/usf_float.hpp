@@ -15,6 +15,14 @@ namespace usf::internal::Float
 
     int convert(CharType* const significand, int& exponent,
             double value, const bool format_fixed, const int precision) noexcept;
+
+    // Parses a decimal floating point number at `it` (std::from_chars
+    // general format: optional minus sign, digits with an optional decimal
+    // point, optional exponent, or "inf", "infinity", "nan"), correctly
+    // rounded, advancing `it` past it. Returns error::inv_format if there
+    // is no number, error::value_overflow if it rounds to zero or infinity.
+    error parse(const CharType*& it, const CharType* end, double& value) noexcept;
+    error parse(const CharType*& it, const CharType* end, float& value) noexcept;
         
 } // namespace usf
 
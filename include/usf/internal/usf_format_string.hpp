@@ -0,0 +1,621 @@
+// ----------------------------------------------------------------------------
+// @file    usf_format_string.hpp
+// @brief   Format strings known at compile time. The format string is parsed
+//          and validated against the argument types at compile time.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf::internal
+{
+
+// ----------------------------------------------------------------------------
+// ARGUMENT KINDS
+// ----------------------------------------------------------------------------
+
+// Argument categories, as selected by the make_argument() overloads.
+enum class ArgKind : uint8_t
+{
+    kBool,
+    kChar,
+    kInteger,
+    kPointer,
+    kFloat,
+    kString,
+    kCustom,
+    kIntegerRange,
+    kByteRange
+};
+
+template <typename T>
+constexpr ArgKind arg_kind() noexcept
+{
+    // Named arguments have the kind of their value
+    if constexpr(ArgTraits<T>::kNamed)
+    {
+        return arg_kind<typename std::decay<typename ArgTraits<T>::ValueType>::type>();
+    }
+    else if constexpr(std::is_same<T, bool>::value) { return ArgKind::kBool;    }
+    else if constexpr(std::is_same<T, char>::value) { return ArgKind::kChar;    }
+    else if constexpr(std::is_integral<T>::value)   { return ArgKind::kInteger; }
+#if defined(USF_INT128_SUPPORT)
+    else if constexpr(std::is_same<T, int128_t>::value || std::is_same<T, uint128_t>::value)
+    {
+        return ArgKind::kInteger;
+    }
+#endif
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    else if constexpr(std::is_same<T, float>::value || std::is_same<T, double>::value)
+    {
+        return ArgKind::kFloat;
+    }
+#endif
+    else if constexpr(std::is_same<T, void*>::value || std::is_same<T, const void*>::value)
+    {
+        return ArgKind::kPointer;
+    }
+    else if constexpr(std::is_convertible<T, StringView>::value) { return ArgKind::kString;       }
+    else if constexpr(std::is_same<T, IntegerRange>::value)      { return ArgKind::kIntegerRange; }
+    else if constexpr(std::is_same<T, ByteRange>::value)         { return ArgKind::kByteRange;    }
+    else                                                         { return ArgKind::kCustom;       }
+}
+
+// Same validation as the argument writers (Argument::format_xxx()) do at
+// run time, returning the same error codes.
+constexpr error check_argument(const ArgFormat& format, const ArgKind kind) noexcept
+{
+    if(format.grouping() && kind != ArgKind::kInteger && !(kind == ArgKind::kFloat && format.type_is_float_fixed())) {
+        return error::inv_format;
+    }
+
+    const bool none = format.type_is_none();
+
+    switch(kind)
+    {
+        case ArgKind::kBool:
+            return (none || format.type_is_integer()) ? error::success : error::type_mismatch;
+        case ArgKind::kChar:
+            return (none || format.type_is_char() || format.type_is_integer()) ? error::success : error::type_mismatch;
+        case ArgKind::kInteger:
+            return (none || format.type_is_integer()) ? error::success : error::arg_type;
+        case ArgKind::kPointer:
+            return (none || format.type_is_pointer()) ? error::success : error::type_mismatch;
+        case ArgKind::kFloat:
+            return (none || format.type_is_float()) ? error::success : error::type_mismatch;
+        case ArgKind::kString:
+            return (none || format.type_is_string() || format.type_is_debug()) ? error::success : error::arg_type;
+        case ArgKind::kCustom:
+            return format.is_empty() ? error::success : error::no_custom_format;
+        case ArgKind::kIntegerRange:
+            if(!(none || format.type_is_integer_dec())) { return error::type_mismatch; }
+            return (format.sign() == ArgFormat::Sign::kNone) ? error::success : error::inv_sign;
+        case ArgKind::kByteRange:
+            // The layout (hexadecimal or base64) is tested at run time.
+            if(!(none || format.type_is_integer_hex() || format.type_is_string())) { return error::type_mismatch; }
+            return (format.sign() == ArgFormat::Sign::kNone) ? error::success : error::inv_sign;
+    }
+    return error::success;
+}
+
+// ----------------------------------------------------------------------------
+// FORMAT PROGRAM
+// ----------------------------------------------------------------------------
+
+// Format string parsed at compile time: a sequence of literal text (with the
+// "{{" and "}}" escapes resolved) and argument field segments.
+template <std::size_t kSegments, std::size_t kChars>
+struct FormatProgram
+{
+    struct Segment
+    {
+        ArgFormat format{};
+        int       offset = 0;   // Literal text: position in `chars`
+        int       size   = 0;   // Literal text size (0 for argument fields)
+        int       index  = 0;   // Argument fields: argument index
+        int       repeat = -1;  // Argument fields: previous field of the same
+                                // argument and format spec (same output), or -1
+    };
+
+    std::array<Segment, kSegments> segments{};
+    std::array<CharType, kChars>   chars{};
+
+    int   segment_count = 0;
+    int   char_count    = 0;
+    error err           = error::success;
+};
+
+// Parses `fmt` into a program. The first pass (kSegments and kChars 0) only
+// counts the segments and characters needed to store the program. `names`
+// are the names of the first `name_count` arguments of the `arg_count`.
+template <std::size_t kSegments, std::size_t kChars>
+constexpr FormatProgram<kSegments, kChars> compile_format(const StringView fmt, const int arg_count,
+                                                          const StringView* const names, const int name_count) noexcept
+{
+    FormatProgram<kSegments, kChars> program{};
+
+    // Argument's sequential index
+    int arg_seq_index = 0;
+    bool literal = false;
+
+    const CharType* it = fmt.cbegin();
+
+    while(it < fmt.cend())
+    {
+        if(*it == '{' && *(it + 1) != '{')
+        {
+            StringView spec(it, fmt.cend());
+            const ArgFormat format(spec, arg_count, names, name_count);
+
+            if(format.ec_error() != error::success) {
+                program.err = format.ec_error();
+                return program;
+            }
+
+            // Determine which argument index to use, sequential or positional.
+            const int arg_index = (format.index() < 0) ? arg_seq_index++ : format.index();
+
+            if(arg_index >= arg_count) {
+                program.err = (arg_count == 0) ? error::no_format_arg : error::arg_index_too_large;
+                return program;
+            }
+
+            if(static_cast<std::size_t>(program.segment_count) < kSegments)
+            {
+                auto& segment = program.segments[static_cast<std::size_t>(program.segment_count)];
+                segment.format = format;
+                segment.index  = arg_index;
+
+                for(int n = 0; n < program.segment_count && segment.repeat < 0; ++n)
+                {
+                    const auto& field = program.segments[static_cast<std::size_t>(n)];
+
+                    if(field.size == 0 && field.repeat < 0 && field.index == arg_index && field.format.same_spec(format)) {
+                        segment.repeat = n;
+                    }
+                }
+            }
+            ++program.segment_count;
+
+            literal = false;
+            it = spec.cbegin();
+        }
+        else
+        {
+            if(*it == '{')
+            {
+                // Found '{{' escape character, skip the first '{'.
+                ++it;
+            }
+            else if(*it == '}')
+            {
+                if(*(it + 1) != '}') {
+                    program.err = error::arg_enclose;
+                    return program;
+                }
+
+                // Found '}}' escape character, skip the first '}'.
+                ++it;
+            }
+
+            if(!literal)
+            {
+                if(static_cast<std::size_t>(program.segment_count) < kSegments) {
+                    program.segments[static_cast<std::size_t>(program.segment_count)].offset = program.char_count;
+                }
+                ++program.segment_count;
+                literal = true;
+            }
+
+            if(static_cast<std::size_t>(program.char_count) < kChars
+            && static_cast<std::size_t>(program.segment_count) <= kSegments)
+            {
+                program.chars[static_cast<std::size_t>(program.char_count)] = *it;
+                ++program.segments[static_cast<std::size_t>(program.segment_count - 1)].size;
+            }
+            ++program.char_count;
+            ++it;
+        }
+    }
+
+    return program;
+}
+
+template <typename Program, std::size_t N>
+constexpr error check_arguments(const Program& program, const std::array<ArgKind, N>& kinds) noexcept
+{
+    for(int n = 0; n < program.segment_count; ++n)
+    {
+        const auto& segment = program.segments[static_cast<std::size_t>(n)];
+
+        if(segment.size == 0)
+        {
+            const error err = check_argument(segment.format, kinds[static_cast<std::size_t>(segment.index)]);
+            if(err != error::success) {
+                return err;
+            }
+        }
+    }
+    return error::success;
+}
+
+// Fields written again by later fields (see FormatProgram::Segment::repeat).
+template <std::size_t kSegments, std::size_t kChars>
+constexpr std::array<bool, kSegments> repeated_segments(const FormatProgram<kSegments, kChars>& program) noexcept
+{
+    std::array<bool, kSegments> result{};
+
+    for(std::size_t n = 0; n < kSegments; ++n)
+    {
+        if(program.segments[n].size == 0 && program.segments[n].repeat >= 0) {
+            result[static_cast<std::size_t>(program.segments[n].repeat)] = true;
+        }
+    }
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// MAXIMUM FORMATTED SIZE
+// ----------------------------------------------------------------------------
+
+// Worst case number of digits (group separators included) of a `bits` bits
+// integer formatted as specified by `format`.
+constexpr int max_integer_digits(const ArgFormat& format, const int bits, const bool is_signed) noexcept
+{
+    if(format.type_is_integer_hex()) { return (bits + 3) / 4; }
+    if(format.type_is_integer_oct()) { return (bits + 2) / 3; }
+    if(format.type_is_integer_bin()) { return bits; }
+
+    // Only 2^63 has less decimal digits than 2^64 - 1
+    const int digits = (bits <= 8) ? 3 : (bits <= 16) ? 5 : (bits <= 32) ? 10 : (bits <= 64) ? (is_signed ? 19 : 20) : 39;
+
+    return digits + format.group_separators(digits);
+}
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+// Worst case size of a floating point value formatted as specified by
+// `format`. Values outside [1e-19; 1.8446744e19] are written as "ovf", so
+// the integer part has at most 20 digits.
+constexpr int max_float_size(const ArgFormat& format) noexcept
+{
+    const int precision = (format.precision() < 0) ? 6 : format.precision();
+    const int point = (precision > 0 || format.hash()) ? 1 : 0;
+
+    int digits = 0;
+
+    if(format.type_is_float_scientific())
+    {
+        // d.<precision>e+XX
+        digits = 5 + point + precision;
+    }
+    else if(format.type_is_float_fixed())
+    {
+        // <20 digits>.<precision> or 0.<precision>
+        digits = std::max(20 + format.group_separators(20) + point + precision, 2 + precision);
+    }
+    else
+    {
+        // General format: `precision` significant digits, in exponent or
+        // fixed point format (with up to 4 leading zeros).
+        const int significant = (precision > 0) ? precision - 1 : 0;
+        digits = 6 + significant;
+    }
+
+    return format.sign_width(true) + digits;
+}
+#endif
+
+// Worst case size of a string of `size` characters quoted and escaped
+// ("{:?}"), each character escaped as \u00XX.
+template <typename T>
+constexpr T debug_string_size(const T size) noexcept
+{
+    return 2 + 6 * size;
+}
+
+// Worst case size of an argument of type `T` formatted as specified by
+// `format`, or -1 if the size is not bounded (strings without precision,
+// ranges and custom types).
+template <typename T>
+constexpr int max_argument_size(const ArgFormat& format) noexcept
+{
+    // Named arguments are sized by their value
+    using Value = typename ArgTraits<typename std::remove_cv<typename std::remove_reference<T>::type>::type>::ValueType;
+    using Type = typename std::remove_cv<typename std::remove_reference<Value>::type>::type;
+    using Decayed = typename std::decay<Value>::type;
+
+    constexpr ArgKind kind = arg_kind<Decayed>();
+
+    int size = -1;
+
+    if constexpr(kind == ArgKind::kBool)
+    {
+        size = format.type_is_none() ? 5 : format.sign_width(false) + format.prefix_width() + max_integer_digits(format, 1, false);
+    }
+    else if constexpr(kind == ArgKind::kChar)
+    {
+        size = (format.type_is_none() || format.type_is_char()) ? 1
+             : format.sign_width(std::is_signed<CharType>::value) + format.prefix_width()
+               + max_integer_digits(format, CHAR_BIT, std::is_signed<CharType>::value);
+    }
+    else if constexpr(kind == ArgKind::kInteger)
+    {
+        constexpr bool is_signed = !Integer::is_unsigned<Decayed>::value;
+
+        size = format.sign_width(is_signed) + format.prefix_width()
+             + max_integer_digits(format, static_cast<int>(sizeof(Decayed) * CHAR_BIT), is_signed);
+    }
+    else if constexpr(kind == ArgKind::kPointer)
+    {
+        size = format.sign_width(false) + format.prefix_width() + static_cast<int>(2 * sizeof(std::uintptr_t));
+    }
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    else if constexpr(kind == ArgKind::kFloat)
+    {
+        size = max_float_size(format);
+    }
+#endif
+    else if constexpr(kind == ArgKind::kString)
+    {
+        // Character arrays (string literals) are bounded by their size
+        if constexpr(std::is_array<Type>::value) {
+            size = static_cast<int>(std::extent<Type>::value) - 1;
+        }
+        if(format.precision() >= 0 && (size < 0 || format.precision() < size)) {
+            size = format.precision();
+        }
+        if(format.type_is_debug() && size >= 0) {
+            size = debug_string_size(size);
+        }
+    }
+
+    if(size < 0) {
+        return -1;
+    }
+    return std::max(size, format.width());
+}
+
+using ArgumentSize = int (*)(const ArgFormat& format) noexcept;
+
+// Compile-time bound of the output size of each segment of `program`: the
+// literal text size or the worst case size of the argument field (-1 if
+// not bounded).
+template <std::size_t kSegments, std::size_t kChars, std::size_t N>
+constexpr std::array<int, kSegments> segment_sizes(const FormatProgram<kSegments, kChars>& program,
+                                                   const std::array<ArgumentSize, N>& sizes) noexcept
+{
+    std::array<int, kSegments> result{};
+
+    if(program.err == error::success)
+    {
+        for(std::size_t n = 0; n < kSegments; ++n)
+        {
+            const auto& segment = program.segments[n];
+
+            result[n] = (segment.size > 0) ? segment.size
+                                           : sizes[static_cast<std::size_t>(segment.index)](segment.format);
+        }
+    }
+    return result;
+}
+
+// Sum of the bounded segment sizes, the null terminator included.
+template <std::size_t kSegments>
+constexpr int bounded_size(const std::array<int, kSegments>& sizes) noexcept
+{
+    int size = 1;
+
+    for(const int segment_size : sizes)
+    {
+        if(segment_size > 0) { size += segment_size; }
+    }
+    return size;
+}
+
+template <std::size_t N>
+constexpr bool any_of(const std::array<bool, N>& values) noexcept
+{
+    for(const bool value : values)
+    {
+        if(value) { return true; }
+    }
+    return false;
+}
+
+template <std::size_t kSegments>
+constexpr bool all_bounded(const std::array<int, kSegments>& sizes) noexcept
+{
+    for(const int segment_size : sizes)
+    {
+        if(segment_size < 0) { return false; }
+    }
+    return true;
+}
+
+// Returns true if the output size of `program` can be checked up front: the
+// fields not bounded at compile time are strings (sized at run time).
+template <typename Program, std::size_t kSegments, std::size_t N>
+constexpr bool size_checkable(const Program& program, const std::array<int, kSegments>& sizes,
+                              const std::array<ArgKind, N>& kinds) noexcept
+{
+    for(std::size_t n = 0; n < kSegments; ++n)
+    {
+        if(sizes[n] < 0 && kinds[static_cast<std::size_t>(program.segments[n].index)] != ArgKind::kString) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// COMPILED FORMAT
+// ----------------------------------------------------------------------------
+
+// The compile-time parsed format string `Fmt` and its validation against
+// the (decayed) argument types `Args`.
+template <typename Fmt, typename... Args>
+struct CompiledFormat
+{
+    static constexpr int kArgCount = static_cast<int>(sizeof...(Args));
+
+    // Argument names known at compile time (run time names can't be used)
+    static constexpr std::array<StringView, sizeof...(Args)> kNames{{ArgTraits<Args>::static_name()...}};
+
+    static constexpr auto kSizes = compile_format<0, 0>(Fmt::view(), kArgCount, kNames.data(), kArgCount);
+
+    static constexpr auto kProgram = compile_format<static_cast<std::size_t>(kSizes.segment_count),
+                                                    static_cast<std::size_t>(kSizes.char_count)>(Fmt::view(), kArgCount, kNames.data(), kArgCount);
+
+    static constexpr auto kKinds = std::array<ArgKind, sizeof...(Args)>{{arg_kind<Args>()...}};
+
+    static constexpr error kFormatError = kProgram.err;
+
+    static constexpr error kArgumentError = (kFormatError != error::success) ? error::success
+                                          : check_arguments(kProgram, kKinds);
+
+    // Output size bounds: strings without precision are sized at run time,
+    // ranges and custom types disable the up-front size check.
+    static constexpr auto kSegmentSizes = segment_sizes(kProgram,
+                                                        std::array<ArgumentSize, sizeof...(Args)>{{&max_argument_size<Args>...}});
+
+    static constexpr int  kBoundedSize = bounded_size(kSegmentSizes);
+    static constexpr bool kSizeCheck   = size_checkable(kProgram, kSegmentSizes, kKinds);
+
+    // Fields copied from the output of a previous field
+    static constexpr auto kRepeated = repeated_segments(kProgram);
+    static constexpr bool kRepeats  = any_of(kRepeated);
+
+    using Segments = std::make_index_sequence<static_cast<std::size_t>(kProgram.segment_count)>;
+};
+
+// Output of an argument field, kept for the later fields that repeat it.
+struct RenderedField
+{
+    const CharType* data = nullptr;
+    std::ptrdiff_t  size = 0;
+};
+
+// Output size of the segment `I` not bounded at compile time.
+template <typename Compiled, std::size_t I>
+inline std::ptrdiff_t unbounded_size(const Argument* const args) noexcept
+{
+    if constexpr(Compiled::kSegmentSizes[I] >= 0)
+    {
+        static_cast<void>(args);
+        return 0;
+    }
+    else
+    {
+        constexpr auto& segment = Compiled::kProgram.segments[I];
+
+        if constexpr(segment.format.type_is_debug()) {
+            return std::max<std::ptrdiff_t>(segment.format.width(), debug_string_size(args[segment.index].string_size()));
+        }
+        return std::max<std::ptrdiff_t>(segment.format.width(), args[segment.index].string_size());
+    }
+}
+
+// Runs the segment `I` of a compiled format string. `fields` keeps the
+// output of the fields repeated later (nullptr if none).
+template <typename Compiled, std::size_t I, Checks kChecks>
+inline error run_segment(StringSpan& str, const Argument* const args, [[maybe_unused]] RenderedField* const fields)
+{
+    constexpr auto& segment = Compiled::kProgram.segments[I];
+
+    if constexpr(segment.size > 0)
+    {
+        // Literal text (always leaving room for the null terminator)
+        if(kChecks != Checks::kNone && segment.size >= str.size()) {
+            return error::buf_overflow;
+        }
+
+        CharType* it = str.begin();
+        CharTraits::copy(it, Compiled::kProgram.chars.data() + segment.offset, segment.size);
+        str.remove_prefix(segment.size);
+        return error::success;
+    }
+    else if constexpr(segment.repeat >= 0)
+    {
+        // Same argument and format spec as a previous field, copy its output.
+        const RenderedField& field = fields[segment.repeat];
+
+        if(kChecks != Checks::kNone && field.size >= str.size()) {
+            return error::buf_overflow;
+        }
+
+        CharType* it = str.begin();
+        CharTraits::copy(it, field.data, field.size);
+        str.remove_prefix(field.size);
+        return error::success;
+    }
+    else
+    {
+        // Argument field, validated at compile time
+        ArgFormat format = segment.format;
+
+        if constexpr(Compiled::kRepeated[I])
+        {
+            const CharType* const begin = str.begin();
+
+            const error err = args[segment.index].template format<kChecks>(str, format);
+            fields[I] = RenderedField{begin, str.begin() - begin};
+            return err;
+        }
+        else
+        {
+            return args[segment.index].template format<kChecks>(str, format);
+        }
+    }
+}
+
+template <typename Compiled, std::size_t... I>
+inline error process(StringSpan& str, [[maybe_unused]] const Argument* const args, std::index_sequence<I...>)
+{
+    // Output of the repeated fields (kept on the stack only if any)
+    std::array<RenderedField, Compiled::kRepeats ? sizeof...(I) : 0> rendered{};
+    [[maybe_unused]] RenderedField* const fields = rendered.data();
+
+    if constexpr(Compiled::kSizeCheck)
+    {
+        // Single output size check up front, then no bounds checks at all.
+        // Falls back to the checked writers if the bound doesn't fit.
+        if(Compiled::kBoundedSize + (unbounded_size<Compiled, I>(args) + ... + 0) <= str.size())
+        {
+            static_cast<void>((run_segment<Compiled, I, Checks::kNone>(str, args, fields), ...));
+            return error::success;
+        }
+    }
+
+    error err = error::success;
+
+    // Stops at the first failing segment
+    static_cast<void>((((err = run_segment<Compiled, I, Checks::kBounds>(str, args, fields)) == error::success) && ...));
+
+    if(err == error::success && str.empty()) {
+        err = error::buf_overflow;
+    }
+    return err;
+}
+
+// Maximum formatted size of the compile-time format string `Fmt` with
+// arguments of types `Args` (character arrays are bounded by their size).
+template <typename Fmt, typename... Args>
+struct MaxFormattedSize
+{
+    using Compiled = CompiledFormat<Fmt, typename std::decay<Args>::type...>;
+
+    static_assert(Compiled::kFormatError == error::success,
+                  "usf::max_formatted_size(): invalid format string!");
+    static_assert(Compiled::kArgumentError == error::success,
+                  "usf::max_formatted_size(): format spec doesn't match the argument type!");
+
+    static constexpr auto kSegmentSizes = segment_sizes(Compiled::kProgram,
+                                                        std::array<ArgumentSize, sizeof...(Args)>{{&max_argument_size<Args>...}});
+
+    static_assert(all_bounded(kSegmentSizes),
+                  "usf::max_formatted_size(): unbounded argument size (strings need a precision, no ranges or custom types)!");
+
+    static constexpr int kValue = bounded_size(kSegmentSizes);
+};
+
+} // namespace usf::internal
@@ -7,32 +7,93 @@
 #pragma once
 #include <cstdint>
 
+namespace usf
+{
+#if defined(USF_INT128_SUPPORT)
+    // __extension__ silences the pedantic warnings of strict ISO C++ modes.
+    __extension__ typedef          __int128  int128_t;
+    __extension__ typedef unsigned __int128 uint128_t;
+#endif
+} // namespace usf
+
 namespace usf::internal::Integer
 {
+    // std::is_unsigned extended to uint128_t, which the standard traits
+    // don't classify as an integer type in strict ISO C++ modes.
+    template <typename T> struct is_unsigned : std::is_unsigned<T> {};
+#if defined(USF_INT128_SUPPORT)
+    template <> struct is_unsigned<uint128_t> : std::true_type {};
+#endif
+
     int count_digits_dec(const uint32_t n) noexcept;
     int count_digits_dec(const uint64_t n) noexcept;
     int count_digits_bin(const uint32_t n) noexcept;
     int count_digits_bin(const uint64_t n) noexcept;
 
+#if defined(USF_INT128_SUPPORT)
+    int count_digits_dec(const uint128_t n) noexcept;
+    int count_digits_bin(const uint128_t n) noexcept;
+#endif
+
+    // Total number of decimal digits of all the `count` elements of `values`.
+    std::ptrdiff_t count_digits_dec(const uint32_t* values, std::ptrdiff_t count) noexcept;
+
     template <typename T,
                   typename std::enable_if<std::numeric_limits<T>::is_integer && std::is_unsigned<T>::value, bool>::type = true>
         static constexpr int count_digits_oct(T n) noexcept
         {
-            int digits = 1;
-            while((n >>= 3U) != 0) { ++digits; }
-            return digits;
+            // The result of __builtin_clz() is undefined if `n` is 0.
+            if(n < 8) { return 1; }
+
+            // ((bits + 2) * 43) >> 7 == (bits + 2) / 3 for up to 64 bits
+            // (avoids a division instruction when optimizing for size).
+            if constexpr(sizeof(T) <= sizeof(uint32_t))
+            {
+                return ((32 - __builtin_clz(n) + 2) * 43) >> 7;
+            }
+            else
+            {
+                return ((64 - __builtin_clzll(n) + 2) * 43) >> 7;
+            }
         }
 
     template <typename T,
                   typename std::enable_if<std::numeric_limits<T>::is_integer && std::is_unsigned<T>::value, bool>::type = true>
         static constexpr int count_digits_hex(T n) noexcept
         {
-            int digits = 1;
-            while((n >>= 4U) != 0) { ++digits; }
-            return digits;
+            // The result of __builtin_clz() is undefined if `n` is 0.
+            if(n < 16) { return 1; }
+
+            if constexpr(sizeof(T) <= sizeof(uint32_t))
+            {
+                return (32 - __builtin_clz(n) + 3) >> 2;
+            }
+            else
+            {
+                return (64 - __builtin_clzll(n) + 3) >> 2;
+            }
         }
 
-    
+#if defined(USF_INT128_SUPPORT)
+    // The standard type traits don't classify __int128 as an integer in
+    // strict ISO C++ modes, hence the explicit overloads.
+    static constexpr int count_digits_oct(const uint128_t n) noexcept
+    {
+        const auto high = static_cast<uint64_t>(n >> 64U);
+        if(high == 0) { return count_digits_oct(static_cast<uint64_t>(n)); }
+
+        // ((bits + 2) * 683) >> 11 == (bits + 2) / 3 for up to 128 bits
+        return ((128 - __builtin_clzll(high) + 2) * 683) >> 11;
+    }
+
+    static constexpr int count_digits_hex(const uint128_t n) noexcept
+    {
+        const auto high = static_cast<uint64_t>(n >> 64U);
+        return (high == 0) ? count_digits_hex(static_cast<uint64_t>(n))
+                           : 16 + count_digits_hex(high);
+    }
+#endif
+
     uint32_t pow10_uint32(const int index) noexcept;
     uint64_t pow10_uint64(const int index) noexcept;
 
@@ -42,8 +103,51 @@ namespace usf::internal::Integer
     void convert_bin(CharType* dst, uint64_t value) noexcept;
     void convert_oct(CharType* dst, uint32_t value) noexcept;
     void convert_oct(CharType* dst, uint64_t value) noexcept;
+
+    // Writes exactly `digits` binary / octal digits (zero padded), with
+    // `digits` in the range [1, 64] / [1, 22], e.g. for "{:032b}" formats.
+    void convert_bin(CharType* dst, uint32_t value, const int digits) noexcept;
+    void convert_bin(CharType* dst, uint64_t value, const int digits) noexcept;
+    void convert_oct(CharType* dst, uint32_t value, const int digits) noexcept;
+    void convert_oct(CharType* dst, uint64_t value, const int digits) noexcept;
     void convert_hex(CharType* dst, uint32_t value, const bool uppercase) noexcept;
     void convert_hex(CharType* dst, uint64_t value, const bool uppercase) noexcept;
 
-} // namespace usf
+    // Writes exactly `digits` hexadecimal digits (zero padded), with
+    // `digits` in the range [1, 16], e.g. for "{:016x}" formats.
+    void convert_hex(CharType* dst, uint32_t value, const bool uppercase, const int digits) noexcept;
+    void convert_hex(CharType* dst, uint64_t value, const bool uppercase, const int digits) noexcept;
+
+#if defined(USF_INT128_SUPPORT)
+    // 128 bit converters. The decimal one divides by 10^19 into 64 bit
+    // chunks, the fixed digit ones accept `digits` in the range [1, 128]
+    // (binary), [1, 43] (octal) and [1, 32] (hexadecimal).
+    void convert_dec(CharType* dst, uint128_t value) noexcept;
+    void convert_bin(CharType* dst, uint128_t value, const int digits) noexcept;
+    void convert_oct(CharType* dst, uint128_t value, const int digits) noexcept;
+    void convert_hex(CharType* dst, uint128_t value, const bool uppercase, const int digits) noexcept;
+#endif
+
+    // Writes `value` with a `separator` every 3 digits (from the right).
+    // The output size is count_digits_dec(value) plus the separators.
+    void convert_dec(CharType* dst, uint32_t value, const CharType separator) noexcept;
+    void convert_dec(CharType* dst, uint64_t value, const CharType separator) noexcept;
+#if defined(USF_INT128_SUPPORT)
+    void convert_dec(CharType* dst, uint128_t value, const CharType separator) noexcept;
+#endif
+
+    // Converts the `count` elements of `values` to decimal, separated by
+    // `separator`. The output size is count_digits_dec(values, count) plus
+    // (count - 1) separators.
+    void convert_dec(CharType* dst, const uint32_t* values, std::ptrdiff_t count,
+                     const StringView& separator) noexcept;
+
+    // Parse the digits at `it` (decimal, or binary / octal / hexadecimal
+    // with `bits` 1 / 3 / 4 per digit), advancing `it` past the last one.
+    // Values larger than 64 bits return error::value_overflow, the digits
+    // are consumed still.
+    error parse_dec(const CharType*& it, const CharType* end, uint64_t& value) noexcept;
+    error parse_pow2(const CharType*& it, const CharType* end, uint64_t& value, const int bits) noexcept;
+
+} // namespace usf::internal::Integer
 
@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// @file    usf_json_writer.hpp
+// @brief   Streaming JSON writer: values written with the integer, floating
+//          point and string escaping converters directly (no format string),
+//          nesting tracked on a fixed-depth stack (no allocation).
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf
+{
+
+// Writes a JSON text to a string span, e.g.:
+//   usf::JsonWriter json(usf::StringSpan(str, 256));
+//   json.begin_object()
+//           .member("time", 1234).member("level", "warn")
+//           .key("tags").begin_array().value(1).value(2.5).end_array()
+//       .end_object();
+//   auto [err, span] = json.finish();
+// writes {"time":1234,"level":"warn","tags":[1,2.5]}.
+//
+// The first error (error::buf_overflow if the span is too small or the
+// nesting deeper than kMaxDepth, error::inv_format if the calls don't make
+// a valid JSON text, e.g. a value without a key in an object) is kept, the
+// calls following it do nothing: checking finish() is enough.
+//
+// With a sink, the writer formats into a reserved record, e.g.:
+//   auto [err, record] = sink.reserve(256);
+//   usf::JsonWriter json(record.span);
+//   ...
+//   sink.commit(record, json.size());
+class JsonWriter
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC DEFINITIONS
+        // --------------------------------------------------------------------
+
+        // Maximum number of objects and arrays open (one bit each)
+        static constexpr int kMaxDepth = 32;
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        explicit JsonWriter(StringSpan str) noexcept
+            : m_begin(str.begin()), m_it(str.begin()), m_end(str.end()) {}
+
+        JsonWriter& begin_object() noexcept { return begin_container(true ); }
+        JsonWriter& begin_array () noexcept { return begin_container(false); }
+        JsonWriter& end_object  () noexcept { return end_container(true ); }
+        JsonWriter& end_array   () noexcept { return end_container(false); }
+
+        // Member name, the next value (or object / array) is its value
+        JsonWriter& key(StringView name) noexcept;
+
+        JsonWriter& value(std::nullptr_t) noexcept;
+        JsonWriter& value(bool value) noexcept;
+
+        // Strings are escaped as with the "{:?}" format spec
+        JsonWriter& value(StringView value) noexcept;
+        JsonWriter& value(const CharType* value) noexcept { return this->value(StringView(value)); }
+        JsonWriter& value(const CharType value) noexcept { return this->value(StringView(&value, 1)); }
+
+        // Written as "{}" does (characters are strings, not integers)
+        template <typename T,
+                  typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value
+                                       && !std::is_same<T, CharType>::value, bool>::type = true>
+        JsonWriter& value(const T value) noexcept
+        {
+            static_assert(sizeof(T) <= sizeof(uint64_t), "usf::JsonWriter: unsupported integer type!");
+
+            using Unsigned = typename std::conditional<sizeof(T) <= sizeof(uint32_t), uint32_t, uint64_t>::type;
+
+            const bool     negative = (value < 0);
+            const Unsigned bits     = static_cast<Unsigned>(value);
+
+            return write_integer(negative ? Unsigned(0U - bits) : bits, negative);
+        }
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        // Written as "{:.<precision>g}" does, with `precision` significant
+        // digits (1 to 15, the converter maximum by default). Values out of
+        // the converter range ([1e-19, 1.8e19]) are scaled into it, in
+        // exponent form (e.g. 1e+20, 1e-300). NaN and infinities are not
+        // JSON numbers, they are written as null.
+        // 15 digits don't round-trip all doubles (17 would), e.g. 0.1 + 0.2
+        // is written 0.3: the number read back can differ in the last bits.
+        JsonWriter& value(double value, int precision = 15) noexcept;
+#endif
+
+        // JSON text written as is (e.g. a cached serialized value)
+        JsonWriter& raw(StringView json) noexcept;
+
+        // key(name).value(value)
+        template <typename T>
+        JsonWriter& member(const StringView name, const T& value) noexcept
+        {
+            return key(name).value(value);
+        }
+
+        // Returns the JSON text written, null terminated if not disabled in
+        // configuration, or the first error (error::inv_format if an object
+        // or array is still open or nothing was written).
+        [[nodiscard]] result_t finish() noexcept;
+
+        constexpr error ec_error() const noexcept { return m_error; }
+
+        // Number of characters written
+        constexpr std::ptrdiff_t size() const noexcept { return m_it - m_begin; }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        JsonWriter& begin_container(bool object) noexcept;
+        JsonWriter& end_container(bool object) noexcept;
+
+        JsonWriter& write_integer(uint32_t value, bool negative) noexcept;
+        JsonWriter& write_integer(uint64_t value, bool negative) noexcept;
+
+        // Checks that a value can follow and writes the separator before it
+        bool begin_value() noexcept;
+
+        // Returns the position to write `size` characters at, or nullptr
+        // (error::buf_overflow).
+        CharType* reserve(std::ptrdiff_t size) noexcept;
+
+        void set_error(error err) noexcept { if(m_error == error::success) { m_error = err; } }
+
+        constexpr bool in_object() const noexcept { return ((m_stack >> (m_depth - 1)) & 1U) != 0; }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        CharType* m_begin;
+        CharType* m_it;
+        CharType* m_end;
+
+        uint32_t  m_stack     = 0;        // Bit n set if the level n + 1 is an object
+        int       m_depth     = 0;
+        bool      m_first     = true;     // No element written in the current level yet
+        bool      m_after_key = false;    // Member name written, value expected
+        error     m_error     = error::success;
+};
+
+} // namespace usf
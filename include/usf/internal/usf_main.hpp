@@ -6,16 +6,27 @@
 
 #pragma once
 
+#include <initializer_list>
+
 namespace usf
 {
     namespace internal
     {
         [[nodiscard]] error parse_format_string(usf::StringSpan& str, usf::StringView& fmt);
 
+        // `names` are the argument names (usf::arg), nullptr if none.
         [[nodiscard]] error process(usf::StringSpan& str, usf::StringView& fmt,
-                 const Argument* const args, const int arg_count);
+                 const Argument* const args, const int arg_count,
+                 const usf::StringView* const names = nullptr);
     } // namespace internal
 
+    // Rewrites the argument names of the format string `fmt` ("{port:>5}")
+    // as argument indices ("{1:>5}"), `names` being the argument names in
+    // the order of the arguments. Resolves the names once for a format
+    // string used many times, formatting then takes positional arguments.
+    [[nodiscard]] result_t resolve_arg_names(StringSpan str, StringView fmt,
+                                             std::initializer_list<StringView> names);
+
 
     template <typename... Args> constexpr
     result_t basic_format_to(StringSpan str, StringView fmt)
@@ -43,14 +54,26 @@ namespace usf
     template <typename... Args> constexpr
     result_t basic_format_to(StringSpan str, StringView fmt, Args&&... args)
     {
-        // Nobody should be that crazy, still... it costs nothing to be sure!
-        static_assert(sizeof...(Args) < 32, "usf::basic_format_to(): crazy number of arguments supplied!");
+        // Wide records are fine, up to the argument index range.
+        static_assert(sizeof...(Args) <= internal::ArgFormat::kMaxArgs, "usf::basic_format_to(): crazy number of arguments supplied!");
 
         auto str_begin = str.begin();
 
         const internal::Argument arguments[sizeof...(Args)]{internal::make_argument(args)...};
 
-        if(auto err=internal::process(str, fmt, arguments, static_cast<int>(sizeof...(Args))); err!=error::success) {
+        error err = error::success;
+
+        if constexpr((internal::ArgTraits<typename std::decay<Args>::type>::kNamed || ...))
+        {
+            const StringView names[sizeof...(Args)]{internal::arg_name(args)...};
+            err = internal::process(str, fmt, arguments, static_cast<int>(sizeof...(Args)), names);
+        }
+        else
+        {
+            err = internal::process(str, fmt, arguments, static_cast<int>(sizeof...(Args)));
+        }
+
+        if(err != error::success) {
             return {err, {}};
         }
 
@@ -63,6 +86,138 @@ namespace usf
         return {error::success, StringSpan(str_begin, str.begin())};
     }
 
+    // Format string known at compile time (USF_FMT("...") or C++20
+    // usf::format_to<"...">()). Invalid format strings and format spec /
+    // argument type mismatches are build errors, so the argument writers
+    // skip the corresponding run time checks.
+    template <typename Fmt, typename... Args,
+              typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+    result_t basic_format_to(StringSpan str, Fmt, Args&&... args)
+    {
+        using Compiled = internal::CompiledFormat<Fmt, typename std::decay<Args>::type...>;
+
+        static_assert(Compiled::kFormatError == error::success,
+                      "usf::basic_format_to(): invalid format string!");
+        static_assert(Compiled::kArgumentError == error::success,
+                      "usf::basic_format_to(): format spec doesn't match the argument type!");
+        static_assert(sizeof...(Args) <= internal::ArgFormat::kMaxArgs, "usf::basic_format_to(): crazy number of arguments supplied!");
+
+        auto str_begin = str.begin();
+
+        error err = error::success;
+
+        if constexpr(sizeof...(Args) == 0)
+        {
+            err = internal::process<Compiled>(str, nullptr, typename Compiled::Segments{});
+        }
+        else
+        {
+            const internal::Argument arguments[sizeof...(Args)]{internal::make_argument(args)...};
+            err = internal::process<Compiled>(str, arguments, typename Compiled::Segments{});
+        }
+
+        if(err != error::success) {
+            return {err, {}};
+        }
+
+    #if !defined(USF_DISABLE_STRING_TERMINATION)
+        // If not disabled in configuration, null terminate the resulting string.
+        str[0] = CharType{};
+    #endif
+
+        // Return a string span to the resulting string
+        return {error::success, StringSpan(str_begin, str.begin())};
+    }
+
+    template <typename Fmt, typename... Args,
+              typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+    ssize_t basic_format_to(CharType* str, const std::ptrdiff_t str_count, Fmt fmt, Args&&... args)
+    {
+        auto [err, span] = basic_format_to(StringSpan(str, str_count), fmt, args...);
+        return err==error::success ? ssize_t(span.size()) : ssize_t(err);
+    }
+
+    template <typename Fmt, typename... Args,
+              typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+    ssize_t format_to(char* str, const std::ptrdiff_t str_count, Fmt fmt, Args&&... args)
+    {
+        return basic_format_to(str, str_count, fmt, args...);
+    }
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+    template <internal::FixedString kFmt, typename... Args>
+    result_t basic_format_to(StringSpan str, Args&&... args)
+    {
+        return basic_format_to(str, internal::FixedCompileString<kFmt>{}, args...);
+    }
+
+    template <internal::FixedString kFmt, typename... Args>
+    ssize_t format_to(char* str, const std::ptrdiff_t str_count, Args&&... args)
+    {
+        return basic_format_to(str, str_count, internal::FixedCompileString<kFmt>{}, args...);
+    }
+#endif
+
+    // Buffer size (null terminator included) large enough to format any
+    // values of types `Args` with a format string known at compile time,
+    // computed from the literal text, the field widths and precisions and
+    // the worst case size of each argument type, e.g.:
+    //   constexpr auto size = usf::max_formatted_size<uint32_t, double>(USF_FMT("{:08x} {:.3f}"));
+    //   std::array<char, size> str;
+    // Strings need a precision ("{:.16s}") unless passed as character arrays.
+    template <typename... Args, typename Fmt,
+              typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+    constexpr std::size_t max_formatted_size(Fmt) noexcept
+    {
+        return static_cast<std::size_t>(internal::MaxFormattedSize<Fmt, Args...>::kValue);
+    }
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+    template <internal::FixedString kFmt, typename... Args>
+    constexpr std::size_t max_formatted_size() noexcept
+    {
+        return static_cast<std::size_t>(internal::MaxFormattedSize<internal::FixedCompileString<kFmt>, Args...>::kValue);
+    }
+#endif
+
+    // Formats in constant expressions, returning a usf::StaticString:
+    //   constexpr auto name = usf::static_format(USF_FMT("reg{:02d}"), 7);
+    //   constexpr auto name = usf::static_format<"reg{:02d}">(7);  (C++20)
+    // Booleans, characters, integers and strings (character arrays or
+    // with a precision) are supported.
+    template <typename Fmt, typename... Args,
+              typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+    constexpr auto static_format(Fmt, const Args&... args) noexcept
+    {
+        return internal::static_format<Fmt>(args...);
+    }
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+    template <internal::FixedString kFmt, typename... Args>
+    constexpr auto static_format(const Args&... args) noexcept
+    {
+        return internal::static_format<internal::FixedCompileString<kFmt>>(args...);
+    }
+#endif
+
+    // Renders the compile-time format string `fmt` into `str` with the
+    // initial values `args`, as a template of fixed width fields updated in
+    // place (see usf::SlotTemplate).
+    template <typename Fmt, typename... Args,
+              typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+    SlotTemplate<Fmt, typename std::decay<const Args&>::type...> make_slot_template(StringSpan str, Fmt, const Args&... args) noexcept
+    {
+        return SlotTemplate<Fmt, typename std::decay<const Args&>::type...>(str, args...);
+    }
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+    template <internal::FixedString kFmt, typename... Args>
+    auto make_slot_template(StringSpan str, const Args&... args) noexcept
+    {
+        return SlotTemplate<internal::FixedCompileString<kFmt>, typename std::decay<const Args&>::type...>(str, args...);
+    }
+#endif
+
     template <typename... Args> constexpr
     ssize_t basic_format_to(CharType* str, const std::ptrdiff_t str_count, StringView fmt, Args&&... args)
     {
@@ -0,0 +1,195 @@
+// ----------------------------------------------------------------------------
+// @file    usf_mpsc_sink.hpp
+// @brief   Lock-free multiple producers, single consumer sink: records
+//          reserved with an atomic increment in a shared ring buffer,
+//          formatted in place and published with a commit flag.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace usf
+{
+
+// Ring buffer of records shared by any number of producer threads and read
+// by one consumer thread. A producer reserves a record with a single
+// fetch_add() of the append position, formats into it and commits it by
+// storing its position in the record header; the consumer polls the
+// records committed, in order.
+//
+// The record size is an upper bound of the formatted size: the maximum
+// formatted size of the compile-time format strings with bounded
+// arguments, `max_record` otherwise. The space not used is skipped.
+//
+// The producers wait for the consumer when the buffer is full.
+class MpscSink
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC DEFINITIONS
+        // --------------------------------------------------------------------
+
+        // Reserved record, see reserve().
+        struct Record
+        {
+            StringSpan    span;
+            std::uint64_t position;
+        };
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // `str` is the ring storage (the largest power of two size in it is
+        // used). The run time format strings records reserve `max_record`
+        // characters (null terminator included).
+        explicit MpscSink(StringSpan str, std::ptrdiff_t max_record = 256) noexcept;
+
+        MpscSink(const MpscSink&) = delete;
+        MpscSink& operator=(const MpscSink&) = delete;
+
+        // Reserves a record of `size` characters. Each reserved record must
+        // be committed, the consumer doesn't read past it before.
+        [[nodiscard]] std::pair<error, Record> reserve(std::ptrdiff_t size) noexcept;
+
+        // Commits the first `used` characters of `record`.
+        void commit(const Record& record, std::ptrdiff_t used) noexcept;
+
+        // Returns the formatted size or a negative error code (the record is
+        // committed empty).
+        template <typename... Args>
+        ssize_t format(StringView fmt, Args&&... args) noexcept
+        {
+            return format_record(m_max_record, [&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        template <typename Fmt, typename... Args,
+                  typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+        ssize_t format(Fmt fmt, Args&&... args) noexcept
+        {
+            using Compiled = internal::CompiledFormat<Fmt, typename std::decay<Args>::type...>;
+
+            constexpr bool kBounded = internal::all_bounded(Compiled::kSegmentSizes);
+            const std::ptrdiff_t size = kBounded ? internal::bounded_size(Compiled::kSegmentSizes) : m_max_record;
+
+            return format_record(size, [&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        // Consumer: calls `func(StringView)` with the records committed, in
+        // order, up to the first one not committed yet, releasing their
+        // space. Returns the number of records read (empty ones aside).
+        template <typename Func>
+        int poll(Func&& func)
+        {
+            std::uint64_t read = m_read.load(std::memory_order_relaxed);
+            int count = 0;
+
+            while(m_data != nullptr)
+            {
+                RecordHeader* const record = header(read);
+
+                if(record->position.load(std::memory_order_acquire) != read + 1) {
+                    break;
+                }
+
+                if(record->used > 0)
+                {
+                    func(StringView(reinterpret_cast<const CharType*>(record + 1), static_cast<std::ptrdiff_t>(record->used)));
+                    ++count;
+                }
+
+                const std::uint64_t size = record->size;
+
+                // The next lap headers can be anywhere in the record (the
+                // record sizes differ): the position of every header slot is
+                // cleared before the space is released (ordered by the store
+                // below), the record text never reads as committed.
+                for(std::uint64_t slot = 0; slot < size; slot += kAlign) {
+                    header(read + slot)->position.store(0, std::memory_order_relaxed);
+                }
+
+                read += size;
+                m_read.store(read, std::memory_order_release);
+            }
+            return count;
+        }
+
+        // Ring storage size
+        std::ptrdiff_t capacity() const noexcept { return static_cast<std::ptrdiff_t>(m_capacity); }
+
+        error ec_error() const noexcept { return m_error; }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE DEFINITIONS
+        // --------------------------------------------------------------------
+
+        struct RecordHeader
+        {
+            std::atomic<std::uint64_t> position;    // Record position + 1 once committed
+            std::uint32_t              size;        // Record size, header included
+            std::uint32_t              used;        // Characters formatted
+        };
+
+        static constexpr std::uint64_t kAlign = sizeof(RecordHeader);
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        static constexpr std::uint64_t record_size(const std::uint64_t size) noexcept
+        {
+            return (sizeof(RecordHeader) + size + kAlign - 1) & ~(kAlign - 1);
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        RecordHeader* header(const std::uint64_t position) const noexcept
+        {
+            // Aligned on kAlign, see the constructor
+            return static_cast<RecordHeader*>(static_cast<void*>(m_data + (position & (m_capacity - 1))));
+        }
+
+        // Waits for the consumer to read the records before `end`
+        // (a lap behind).
+        void wait_space(std::uint64_t end) const noexcept;
+
+        void publish(std::uint64_t position, std::uint64_t size, std::ptrdiff_t used) noexcept;
+
+        template <typename Formatter>
+        ssize_t format_record(const std::ptrdiff_t size, Formatter&& formatter) noexcept
+        {
+            const auto [err, record] = reserve(size);
+            if(err != error::success) {
+                return ssize_t(err);
+            }
+
+            const auto [format_err, str] = formatter(record.span);
+
+            commit(record, (format_err == error::success) ? str.size() : 0);
+            return (format_err == error::success) ? ssize_t(str.size()) : ssize_t(format_err);
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        CharType*      m_data       = nullptr;
+        std::uint64_t  m_capacity   = 0;
+        std::ptrdiff_t m_max_record = 0;
+        error          m_error      = error::success;
+
+        // Producers and consumer positions apart, on their own cache lines
+        alignas(64) std::atomic<std::uint64_t> m_reserved{0};
+        alignas(64) std::atomic<std::uint64_t> m_read{0};
+};
+
+} // namespace usf
@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// @file    usf_parse.hpp
+// @brief   Integer and floating point parsing, the inverse of the
+//          formatting (std::from_chars like, without locale or errno).
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf
+{
+
+template <typename T>
+struct ParseResult
+{
+    error      ec;
+    T          value;
+    StringView rest;    // Input following the characters parsed
+};
+
+namespace internal
+{
+
+// With `prefix`, a "0x" or "0b" base prefix (16 or 2) after the sign is
+// skipped, as written by the alternative format ("{:#x}").
+template <typename T>
+ParseResult<T> parse_integer(const StringView str, const int base, const bool prefix = false) noexcept
+{
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= sizeof(uint64_t),
+                  "usf::parse(): unsupported integer type!");
+
+    const CharType*       it  = str.cbegin();
+    const CharType* const end = str.cend();
+
+    bool negative = false;
+
+    if constexpr(std::is_signed<T>::value)
+    {
+        if(it < end && *it == '-')
+        {
+            negative = true;
+            ++it;
+        }
+    }
+
+    if(prefix && end - it > 1 && it[0] == '0'
+    && (((it[1] == 'x' || it[1] == 'X') && base == 16) || ((it[1] == 'b' || it[1] == 'B') && base == 2)))
+    {
+        it += 2;
+    }
+
+    const CharType* const digits = it;
+
+    uint64_t magnitude = 0;
+    error    err       = error::success;
+
+    switch(base)
+    {
+        case 10: err = Integer::parse_dec (it, end, magnitude);    break;
+        case 16: err = Integer::parse_pow2(it, end, magnitude, 4); break;
+        case  8: err = Integer::parse_pow2(it, end, magnitude, 3); break;
+        case  2: err = Integer::parse_pow2(it, end, magnitude, 1); break;
+        default: return {error::inv_type, T{}, str};
+    }
+
+    //USF_ENFORCE(it > digits, std::runtime_error);
+    if(it == digits) {
+        return {error::inv_format, T{}, str};
+    }
+
+    const StringView rest(it, end);
+
+    // The magnitude of the most negative value is max() + 1
+    const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1U : 0U);
+
+    //USF_ENFORCE(magnitude <= limit, std::runtime_error);
+    if(err != error::success || magnitude > limit) {
+        return {error::value_overflow, T{}, rest};
+    }
+
+    using Unsigned = typename std::make_unsigned<T>::type;
+
+    const uint64_t bits = negative ? 0U - magnitude : magnitude;
+    return {error::success, static_cast<T>(static_cast<Unsigned>(bits)), rest};
+}
+
+} // namespace internal
+
+// Parses an integer of type `T` at the beginning of `str`, in base `base`
+// (2, 8, 10 or 16): an optional minus sign (signed types only) and the
+// digits, without leading whitespace, plus sign or base prefix, e.g.:
+//   auto [err, port, rest] = usf::parse<uint16_t>("8080/tcp");
+// Returns error::inv_format if there are no digits (`rest` is `str`),
+// error::value_overflow if the value is out of the range of `T` (`rest`
+// follows the digits) and error::inv_type for other bases.
+//
+// Floating point types (float and double) are parsed in base 10 only, as
+// std::from_chars() general format, correctly rounded:
+//   auto [err, value, rest] = usf::parse<double>("-1.25e-3,");
+// Values rounding to zero or infinity return error::value_overflow.
+template <typename T>
+ParseResult<T> parse(const StringView str, const int base = 10) noexcept
+{
+    if constexpr(std::is_floating_point<T>::value)
+    {
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "usf::parse(): unsupported floating point type!");
+
+        //USF_ENFORCE(base == 10, std::runtime_error);
+        if(base != 10) {
+            return {error::inv_type, T{}, str};
+        }
+
+        const CharType*       it  = str.cbegin();
+        const CharType* const end = str.cend();
+
+        T value{};
+
+        const error err = internal::Float::parse(it, end, value);
+
+        if(it == str.cbegin()) {
+            return {err, T{}, str};
+        }
+        return {err, (err == error::success) ? value : T{}, StringView(it, end)};
+#else
+        static_assert(!std::is_floating_point<T>::value, "usf::parse(): floating point support disabled!");
+#endif
+    }
+    else
+    {
+        return internal::parse_integer<T>(str, base);
+    }
+}
+
+} // namespace usf
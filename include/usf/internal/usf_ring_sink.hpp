@@ -0,0 +1,300 @@
+// ----------------------------------------------------------------------------
+// @file    usf_ring_sink.hpp
+// @brief   In-memory flight recorder: the last records formatted, kept in a
+//          fixed size ring buffer overwriting the oldest ones. For crash
+//          diagnostics, without any I/O or system call while logging.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace usf
+{
+
+// Ring buffer of formatted records in a caller buffer, the newest records
+// overwriting the oldest ones. Records are formatted in place and never
+// split: a record that doesn't fit before the end of the buffer starts
+// back at its beginning, a skip marker covering the end.
+//
+// Single writer by default, without any lock or atomic operation. With
+// `kMultiWriter` the records are formatted under a spin lock, taken by the
+// readers too. Single writer sinks are read from the writer thread or once
+// it stopped (e.g. from a crash handler).
+template <bool kMultiWriter = false>
+class RingSink
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // `str` is the ring storage. The run time format strings records
+        // reserve `max_record` characters (null terminator included), the
+        // compile-time ones their maximum formatted size when bounded.
+        explicit RingSink(StringSpan str, const std::ptrdiff_t max_record = 256) noexcept
+            : m_max_record(max_record)
+        {
+            // Record headers are 4 bytes aligned
+            const auto misalignment = static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(str.begin()) & (kAlign - 1));
+            const std::ptrdiff_t skip = (misalignment > 0) ? kAlign - misalignment : 0;
+
+            if(str.size() > skip)
+            {
+                m_data     = str.begin() + skip;
+                m_capacity = (str.size() - skip) & ~(kAlign - 1);
+            }
+
+            //USF_ENFORCE(record_size(max_record) <= m_capacity, std::runtime_error);
+            if(max_record <= 0 || record_size(max_record) > m_capacity) {
+                m_error = error::buf_overflow;
+            }
+        }
+
+        RingSink(const RingSink&) = delete;
+        RingSink& operator=(const RingSink&) = delete;
+
+        // Returns the formatted size or a negative error code (the record is
+        // not stored, the oldest records may have been overwritten still).
+        template <typename... Args>
+        ssize_t format(StringView fmt, Args&&... args) noexcept
+        {
+            return format_record(m_max_record, [&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        template <typename Fmt, typename... Args,
+                  typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+        ssize_t format(Fmt fmt, Args&&... args) noexcept
+        {
+            using Compiled = internal::CompiledFormat<Fmt, typename std::decay<Args>::type...>;
+
+            constexpr bool kBounded = internal::all_bounded(Compiled::kSegmentSizes);
+            const std::ptrdiff_t size = kBounded ? internal::bounded_size(Compiled::kSegmentSizes) : m_max_record;
+
+            return format_record(size, [&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        // Calls `func(StringView)` with each record, oldest first.
+        template <typename Func>
+        void for_each_record(Func&& func) const
+        {
+            Lock lock(m_lock);
+
+            std::ptrdiff_t offset = m_head;
+
+            for(std::ptrdiff_t used = m_used; used > 0; )
+            {
+                const std::uint32_t size = header(offset);
+
+                if(size == kSkip)
+                {
+                    used  -= m_capacity - offset;
+                    offset = 0;
+                    continue;
+                }
+
+                func(StringView(m_data + offset + kHeaderSize, static_cast<std::ptrdiff_t>(size)));
+
+                const std::ptrdiff_t record = record_size(size);
+                used  -= record;
+                offset = (offset + record == m_capacity) ? 0 : offset + record;
+            }
+        }
+
+        // Copies the records to `str`, oldest first, each followed by
+        // `separator`. The records always fit in capacity() + 1 characters.
+        result_t dump(StringSpan str, const CharType separator = '\n') const noexcept
+        {
+            auto str_begin = str.begin();
+            error err = error::success;
+
+            for_each_record([&](StringView record) noexcept
+            {
+                //USF_ENFORCE(record.size() < str.size(), std::runtime_error);
+                if(err != error::success || record.size() >= str.size())
+                {
+                    err = error::buf_overflow;
+                    return;
+                }
+
+                CharType* it = str.begin();
+                internal::CharTraits::copy(it, record.cbegin(), record.size());
+                *it = separator;
+                str.remove_prefix(record.size() + 1);
+            });
+
+            //USF_ENFORCE(str.size() > 0, std::runtime_error);
+            if(err != error::success || str.size() == 0) {
+                return {error::buf_overflow, {}};
+            }
+
+        #if !defined(USF_DISABLE_STRING_TERMINATION)
+            // If not disabled in configuration, null terminate the resulting string.
+            str[0] = CharType{};
+        #endif
+
+            return {error::success, StringSpan(str_begin, str.begin())};
+        }
+
+        // Discards all the records.
+        void clear() noexcept
+        {
+            Lock lock(m_lock);
+
+            m_head = m_tail = m_used = 0;
+        }
+
+        // Number of records overwritten so far
+        std::uint64_t overwritten() const noexcept { return m_overwritten; }
+
+        // Ring storage size (aligned)
+        std::ptrdiff_t capacity() const noexcept { return m_capacity; }
+
+        error ec_error() const noexcept { return m_error; }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE DEFINITIONS
+        // --------------------------------------------------------------------
+
+        // Record header: the record size (kSkip for the skip marker)
+        static constexpr std::ptrdiff_t kHeaderSize = sizeof(std::uint32_t);
+        static constexpr std::ptrdiff_t kAlign      = sizeof(std::uint32_t);
+        static constexpr std::uint32_t  kSkip       = 0xFFFFFFFFU;
+
+        struct NoLock
+        {
+            explicit NoLock(const std::atomic<bool>&) noexcept {}
+        };
+
+        struct SpinLock
+        {
+            explicit SpinLock(std::atomic<bool>& flag) noexcept : m_flag(flag)
+            {
+                while(m_flag.exchange(true, std::memory_order_acquire))
+                {
+                    while(m_flag.load(std::memory_order_relaxed)) {}
+                }
+            }
+            ~SpinLock() { m_flag.store(false, std::memory_order_release); }
+
+            SpinLock(const SpinLock&) = delete;
+            SpinLock& operator=(const SpinLock&) = delete;
+
+            std::atomic<bool>& m_flag;
+        };
+
+        using Lock = typename std::conditional<kMultiWriter, SpinLock, NoLock>::type;
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        static constexpr std::ptrdiff_t record_size(const std::ptrdiff_t size) noexcept
+        {
+            return (kHeaderSize + size + kAlign - 1) & ~(kAlign - 1);
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        std::uint32_t header(const std::ptrdiff_t offset) const noexcept
+        {
+            std::uint32_t size;
+            std::memcpy(&size, m_data + offset, sizeof(size));
+            return size;
+        }
+
+        void set_header(const std::ptrdiff_t offset, const std::uint32_t size) noexcept
+        {
+            std::memcpy(m_data + offset, &size, sizeof(size));
+        }
+
+        // Drops the oldest records until `size` characters are free after
+        // the tail.
+        void evict(const std::ptrdiff_t size) noexcept
+        {
+            while(m_used > 0 && m_used + size > m_capacity)
+            {
+                const std::uint32_t record = header(m_head);
+
+                if(record == kSkip)
+                {
+                    m_used -= m_capacity - m_head;
+                    m_head  = 0;
+                }
+                else
+                {
+                    const std::ptrdiff_t bytes = record_size(record);
+                    m_used -= bytes;
+                    m_head  = (m_head + bytes == m_capacity) ? 0 : m_head + bytes;
+                    ++m_overwritten;
+                }
+            }
+        }
+
+        template <typename Formatter>
+        ssize_t format_record(const std::ptrdiff_t size, Formatter&& formatter) noexcept
+        {
+            //USF_ENFORCE(record_size(size) <= m_capacity, std::runtime_error);
+            if(m_error != error::success || record_size(size) > m_capacity) {
+                return ssize_t(error::buf_overflow);
+            }
+
+            Lock lock(m_lock);
+
+            const std::ptrdiff_t reserved = record_size(size);
+
+            if(m_used == 0)
+            {
+                m_head = m_tail = 0;
+            }
+            else if(m_tail + reserved > m_capacity)
+            {
+                // Not enough room before the end, the record starts over at
+                // the beginning of the buffer.
+                evict(m_capacity - m_tail);
+                set_header(m_tail, kSkip);
+                m_used += m_capacity - m_tail;
+                m_tail  = 0;
+            }
+            evict(reserved);
+
+            const auto [err, str] = formatter(StringSpan(m_data + m_tail + kHeaderSize, size));
+
+            if(err != error::success) {
+                return ssize_t(err);
+            }
+
+            set_header(m_tail, static_cast<std::uint32_t>(str.size()));
+
+            const std::ptrdiff_t bytes = record_size(str.size());
+            m_used += bytes;
+            m_tail  = (m_tail + bytes == m_capacity) ? 0 : m_tail + bytes;
+
+            return ssize_t(str.size());
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        CharType*      m_data     = nullptr;
+        std::ptrdiff_t m_capacity = 0;
+        std::ptrdiff_t m_max_record;
+        std::ptrdiff_t m_head = 0;      // Oldest record
+        std::ptrdiff_t m_tail = 0;      // Next record
+        std::ptrdiff_t m_used = 0;      // From the head to the tail
+        std::uint64_t  m_overwritten = 0;
+        error          m_error = error::success;
+
+        mutable std::atomic<bool> m_lock{false};
+};
+
+} // namespace usf
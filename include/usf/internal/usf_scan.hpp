@@ -0,0 +1,330 @@
+// ----------------------------------------------------------------------------
+// @file    usf_scan.hpp
+// @brief   Format string driven scanning, the inverse of the formatting:
+//          same format spec grammar, typed outputs filled by the integer
+//          and floating point parsers, zero-copy strings.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf
+{
+namespace internal
+{
+
+class ScanArgument
+{
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC DEFINITIONS
+        // --------------------------------------------------------------------
+
+        // End of the string fields without width, when not followed by
+        // literal text (see scan()).
+        static constexpr int kToSpace = -1;    // Followed by another field
+        static constexpr int kToEnd   = -2;    // Last field
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        constexpr ScanArgument() = delete;
+
+        ScanArgument(bool& value) noexcept
+            : m_pointer(&value), m_type_id(TypeId::kBool) {}
+
+        ScanArgument(CharType& value) noexcept
+            : m_pointer(&value), m_type_id(TypeId::kChar) {}
+
+        template <typename T,
+                  typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value
+                                       && !std::is_same<T, CharType>::value, bool>::type = true>
+        ScanArgument(T& value) noexcept
+            : m_pointer(&value), m_type_id(integer_type_id<T>()) {}
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        ScanArgument(float& value) noexcept
+            : m_pointer(&value), m_type_id(TypeId::kFloat) {}
+
+        ScanArgument(double& value) noexcept
+            : m_pointer(&value), m_type_id(TypeId::kDouble) {}
+#endif
+
+        // Set to a part of the input (not copied)
+        ScanArgument(StringView& value) noexcept
+            : m_pointer(&value), m_type_id(TypeId::kString) {}
+
+        // Scans the field at the beginning of `input` as specified by
+        // `format` and removes it from `input`. The string fields without
+        // width end before the `delimiter` character (the first character
+        // of the literal text following the field), the next whitespace
+        // (kToSpace) or at the end of the input (kToEnd).
+        [[nodiscard]] error scan(StringView& input, const ArgFormat& format, int delimiter) const noexcept;
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE DEFINITIONS
+        // --------------------------------------------------------------------
+
+        enum class TypeId : uint8_t
+        {
+            kBool,
+            kChar,
+            kInt8,
+            kUint8,
+            kInt16,
+            kUint16,
+            kInt32,
+            kUint32,
+            kInt64,
+            kUint64,
+            kFloat,
+            kDouble,
+            kString
+        };
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        template <typename T>
+        static constexpr TypeId integer_type_id() noexcept
+        {
+            static_assert(sizeof(T) <= sizeof(uint64_t), "usf::scan(): unsupported integer type!");
+
+            constexpr bool is_signed = std::is_signed<T>::value;
+
+            return (sizeof(T) == 1) ? (is_signed ? TypeId::kInt8  : TypeId::kUint8 )
+                 : (sizeof(T) == 2) ? (is_signed ? TypeId::kInt16 : TypeId::kUint16)
+                 : (sizeof(T) == 4) ? (is_signed ? TypeId::kInt32 : TypeId::kUint32)
+                 :                    (is_signed ? TypeId::kInt64 : TypeId::kUint64);
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        void*  m_pointer;
+        TypeId m_type_id;
+};
+
+// Same validation as ScanArgument::scan() does at run time: the format
+// spec must match the output type, digit grouping and escaped strings
+// ("{:?}") aren't scanned.
+constexpr error check_scan_argument(const ArgFormat& format, const ArgKind kind) noexcept
+{
+    if(format.grouping()) {
+        return error::inv_format;
+    }
+    if(format.type_is_debug()) {
+        return error::arg_type;
+    }
+    return check_argument(format, kind);
+}
+
+template <typename Program, std::size_t N>
+constexpr error check_scan_arguments(const Program& program, const std::array<ArgKind, N>& kinds) noexcept
+{
+    for(int n = 0; n < program.segment_count; ++n)
+    {
+        const auto& segment = program.segments[static_cast<std::size_t>(n)];
+
+        if(segment.size == 0)
+        {
+            const error err = check_scan_argument(segment.format, kinds[static_cast<std::size_t>(segment.index)]);
+            if(err != error::success) {
+                return err;
+            }
+        }
+    }
+    return error::success;
+}
+
+// Scans `input` as specified by the format string `fmt`, removing the text
+// matched from `input`. `count` is the number of arguments set.
+[[nodiscard]] error scan(StringView& input, StringView fmt,
+                         const ScanArgument* args, int arg_count, int& count) noexcept;
+
+// Same with a parsed format string (see FormatProgram).
+template <typename Program>
+error scan(StringView& input, const Program& program,
+           const ScanArgument* const args, const int arg_count, int& count) noexcept
+{
+    for(int n = 0; n < program.segment_count; ++n)
+    {
+        const auto& segment = program.segments[static_cast<std::size_t>(n)];
+
+        if(segment.size > 0)
+        {
+            // Literal text
+            const CharType* const text = program.chars.data() + segment.offset;
+
+            //USF_ENFORCE(input starts with text, std::runtime_error);
+            if(input.size() < segment.size || !CharTraits::equal(input.cbegin(), text, segment.size)) {
+                return error::no_match;
+            }
+            input.remove_prefix(segment.size);
+        }
+        else
+        {
+            //USF_ENFORCE(segment.index < arg_count, std::runtime_error);
+            if(segment.index >= arg_count) {
+                return (arg_count == 0) ? error::no_format_arg : error::arg_index_too_large;
+            }
+
+            int delimiter = ScanArgument::kToEnd;
+
+            if(n + 1 < program.segment_count)
+            {
+                const auto& next = program.segments[static_cast<std::size_t>(n + 1)];
+
+                delimiter = (next.size > 0) ? static_cast<unsigned char>(program.chars[static_cast<std::size_t>(next.offset)])
+                                            : ScanArgument::kToSpace;
+            }
+
+            if(auto err = args[segment.index].scan(input, segment.format, delimiter); err != error::success) {
+                return err;
+            }
+            ++count;
+        }
+    }
+    return error::success;
+}
+
+template <typename Program, typename... Args>
+ParseResult<int> scan_program(StringView input, const Program& program, Args&... args) noexcept
+{
+    int   count = 0;
+    error err   = error::success;
+
+    if constexpr(sizeof...(Args) == 0)
+    {
+        err = scan(input, program, nullptr, 0, count);
+    }
+    else
+    {
+        const ScanArgument arguments[sizeof...(Args)]{ScanArgument(args)...};
+        err = scan(input, program, arguments, static_cast<int>(sizeof...(Args)), count);
+    }
+    return {err, count, input};
+}
+
+} // namespace internal
+
+// Run time format string parsed once for usf::scan(), so the format string
+// isn't tokenized again for each input scanned, e.g.:
+//   const usf::ScanFormat<> format("{} [{}] {:x}");
+//   for(...) { usf::scan(line, format, time, level, code); }
+// `kSegments` and `kChars` are the maximum number of segments (literal text
+// and fields) and of literal characters (ec_error() is error::buf_overflow
+// if exceeded).
+template <std::size_t kSegments = 16, std::size_t kChars = 64>
+class ScanFormat
+{
+    public:
+
+        explicit constexpr ScanFormat(const StringView fmt) noexcept
+            : m_program(internal::compile_format<kSegments, kChars>(fmt, internal::ArgFormat::kMaxArgs, nullptr, 0))
+        {
+            //USF_ENFORCE(m_program fits, std::runtime_error);
+            if(m_program.err == error::success
+            && (static_cast<std::size_t>(m_program.segment_count) > kSegments
+             || static_cast<std::size_t>(m_program.char_count) > kChars))
+            {
+                m_program.err = error::buf_overflow;
+            }
+        }
+
+        constexpr const internal::FormatProgram<kSegments, kChars>& program() const noexcept { return m_program; }
+
+        constexpr error ec_error() const noexcept { return m_program.err; }
+
+    private:
+
+        internal::FormatProgram<kSegments, kChars> m_program;
+};
+
+// Scans `input` as specified by the format string `fmt`, storing the value
+// of each argument field ("{}", "{:x}", "{1}", ...) in the corresponding
+// output argument, e.g.:
+//   uint32_t time; usf::StringView level(""); int code;
+//   auto [err, count, rest] = usf::scan(line, "{} [{}] {:x}", time, level, code);
+//
+// The literal text must match exactly. The outputs are:
+// - Integers: decimal, "{:x}", "{:o}" and "{:b}" (with "{:#x}" and "{:#b}"
+//   the base prefix is expected), "{:+d}" accepts a leading plus sign.
+// - float and double: decimal, correctly rounded ("{}", "{:f}", "{:e}"...).
+// - usf::StringView: a part of `input` (no copy), up to the first character
+//   of the literal text following the field, to the next whitespace if
+//   another field follows, else to the end of `input`. The precision
+//   ("{:.8s}") limits its size.
+// - bool ("true"/"false", or 1/0 with an integer type) and char.
+// With a width ("{:8}"), the field is the next `width` characters, the
+// fill characters around the value are skipped.
+//
+// Returns the number of outputs set and the input following the text
+// matched (trailing input is allowed). error::no_match if the input doesn't
+// match, error::value_overflow if a value is out of the range of its output,
+// the format string errors otherwise: `rest` then starts at the literal text
+// or field not matched, the outputs before it are set.
+template <typename... Args>
+ParseResult<int> scan(StringView input, const StringView fmt, Args&... args) noexcept
+{
+    static_assert(sizeof...(Args) <= internal::ArgFormat::kMaxArgs, "usf::scan(): crazy number of arguments supplied!");
+
+    int   count = 0;
+    error err   = error::success;
+
+    if constexpr(sizeof...(Args) == 0)
+    {
+        err = internal::scan(input, fmt, nullptr, 0, count);
+    }
+    else
+    {
+        const internal::ScanArgument arguments[sizeof...(Args)]{internal::ScanArgument(args)...};
+        err = internal::scan(input, fmt, arguments, static_cast<int>(sizeof...(Args)), count);
+    }
+    return {err, count, input};
+}
+
+// Format string parsed once (see ScanFormat)
+template <std::size_t kSegments, std::size_t kChars, typename... Args>
+ParseResult<int> scan(const StringView input, const ScanFormat<kSegments, kChars>& fmt, Args&... args) noexcept
+{
+    //USF_ENFORCE(fmt.ec_error() == error::success, std::runtime_error);
+    if(fmt.ec_error() != error::success) {
+        return {fmt.ec_error(), 0, input};
+    }
+    return internal::scan_program(input, fmt.program(), args...);
+}
+
+// Format string known at compile time (USF_FMT("...") or C++20
+// usf::scan<"...">()): invalid format strings and format spec / output
+// type mismatches are build errors.
+template <typename Fmt, typename... Args,
+          typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+ParseResult<int> scan(const StringView input, Fmt, Args&... args) noexcept
+{
+    using Compiled = internal::CompiledFormat<Fmt, typename std::decay<Args>::type...>;
+
+    static_assert(Compiled::kFormatError == error::success,
+                  "usf::scan(): invalid format string!");
+    static_assert(internal::check_scan_arguments(Compiled::kProgram, Compiled::kKinds) == error::success,
+                  "usf::scan(): format spec doesn't match the output type!");
+    static_assert(sizeof...(Args) <= internal::ArgFormat::kMaxArgs, "usf::scan(): crazy number of arguments supplied!");
+
+    return internal::scan_program(input, Compiled::kProgram, args...);
+}
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+template <internal::FixedString kFmt, typename... Args>
+ParseResult<int> scan(const StringView input, Args&... args) noexcept
+{
+    return scan(input, internal::FixedCompileString<kFmt>{}, args...);
+}
+#endif
+
+} // namespace usf
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// @file    usf_scatter.hpp
+// @brief   Scatter-gather output: the formatted string as a list of pieces,
+//          the literal text pointing into the format string and only the
+//          argument fields rendered into a scratch buffer. Ready for
+//          writev() like system calls, without assembling the string.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace usf
+{
+
+// Piece of a scatter-gather output (same members as `struct iovec`).
+struct IoVec
+{
+    const CharType* data;
+    std::ptrdiff_t  size;
+};
+
+// Fixed capacity list of pieces, filled in order.
+class IoVecSpan
+{
+    public:
+
+        constexpr IoVecSpan(IoVec* const iov, const int capacity) noexcept
+            : m_iov(iov), m_capacity(capacity) {}
+
+        template <std::size_t N>
+        constexpr IoVecSpan(IoVec (&iov)[N]) noexcept
+            : m_iov(iov), m_capacity(static_cast<int>(N)) {}
+
+        // Appends a piece, merged with the previous one if contiguous.
+        constexpr error append(const CharType* const data, const std::ptrdiff_t size) noexcept
+        {
+            if(size == 0) {
+                return error::success;
+            }
+
+            if(m_count > 0 && m_iov[m_count - 1].data + m_iov[m_count - 1].size == data)
+            {
+                m_iov[m_count - 1].size += size;
+                return error::success;
+            }
+
+            //USF_ENFORCE(m_count < m_capacity, std::runtime_error);
+            if(m_count >= m_capacity) {
+                return error::buf_overflow;
+            }
+
+            m_iov[m_count++] = IoVec{data, size};
+            return error::success;
+        }
+
+        constexpr const IoVec* data() const noexcept { return m_iov; }
+
+        constexpr int count() const noexcept { return m_count; }
+
+        // Total size of the pieces
+        constexpr std::ptrdiff_t size() const noexcept
+        {
+            std::ptrdiff_t size = 0;
+            for(int n = 0; n < m_count; ++n) { size += m_iov[n].size; }
+            return size;
+        }
+
+    private:
+
+        IoVec* m_iov      = nullptr;
+        int    m_capacity = 0;
+        int    m_count    = 0;
+};
+
+namespace internal
+{
+    // `names` are the argument names (usf::arg), nullptr if none.
+    [[nodiscard]] error process_iov(IoVecSpan& iov, usf::StringSpan& scratch, usf::StringView fmt,
+                                    const Argument* const args, const int arg_count,
+                                    const usf::StringView* const names = nullptr);
+} // namespace internal
+
+// Formats `fmt` as a list of pieces appended to `iov`: the literal text
+// points into `fmt` (which must outlive `iov`) and the argument fields are
+// rendered into `scratch`. Returns the total size of the pieces or a
+// negative error code.
+template <typename... Args>
+ssize_t format_to_iov(IoVecSpan& iov, StringSpan scratch, StringView fmt, Args&&... args)
+{
+    static_assert(sizeof...(Args) <= internal::ArgFormat::kMaxArgs, "usf::format_to_iov(): crazy number of arguments supplied!");
+
+    error err = error::success;
+
+    if constexpr(sizeof...(Args) == 0)
+    {
+        err = internal::process_iov(iov, scratch, fmt, nullptr, 0);
+    }
+    else
+    {
+        const internal::Argument arguments[sizeof...(Args)]{internal::make_argument(args)...};
+
+        if constexpr((internal::ArgTraits<typename std::decay<Args>::type>::kNamed || ...))
+        {
+            const StringView names[sizeof...(Args)]{internal::arg_name(args)...};
+            err = internal::process_iov(iov, scratch, fmt, arguments, static_cast<int>(sizeof...(Args)), names);
+        }
+        else
+        {
+            err = internal::process_iov(iov, scratch, fmt, arguments, static_cast<int>(sizeof...(Args)));
+        }
+    }
+
+    return (err == error::success) ? ssize_t(iov.size()) : ssize_t(err);
+}
+
+} // namespace usf
@@ -0,0 +1,281 @@
+// ----------------------------------------------------------------------------
+// @file    usf_slot_template.hpp
+// @brief   Pre-rendered templates of fixed width fields (slots), updated in
+//          place. For status lines, displays and fixed width report rows,
+//          where only a few fields change at each refresh.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+
+namespace usf
+{
+namespace internal
+{
+
+// Output position of each segment of a compiled format string whose fields
+// all have a width (the slot size), the total size at the end.
+template <std::size_t kSegments, std::size_t kChars>
+constexpr std::array<std::ptrdiff_t, kSegments + 1> slot_offsets(const FormatProgram<kSegments, kChars>& program) noexcept
+{
+    std::array<std::ptrdiff_t, kSegments + 1> result{};
+
+    for(std::size_t n = 0; n < kSegments; ++n)
+    {
+        const auto& segment = program.segments[n];
+        result[n + 1] = result[n] + ((segment.size > 0) ? segment.size : segment.format.width());
+    }
+    return result;
+}
+
+template <typename Program>
+constexpr bool slots_sized(const Program& program) noexcept
+{
+    for(int n = 0; n < program.segment_count; ++n)
+    {
+        const auto& segment = program.segments[static_cast<std::size_t>(n)];
+        if(segment.size == 0 && segment.format.width() == 0) { return false; }
+    }
+    return true;
+}
+
+// Argument field number of each segment (-1 for literal text).
+template <std::size_t kSegments, std::size_t kChars>
+constexpr std::array<int, kSegments> slot_numbers(const FormatProgram<kSegments, kChars>& program) noexcept
+{
+    std::array<int, kSegments> result{};
+    int slot = 0;
+
+    for(std::size_t n = 0; n < kSegments; ++n)
+    {
+        result[n] = (program.segments[n].size > 0) ? -1 : slot++;
+    }
+    return result;
+}
+
+template <std::size_t kSegments>
+constexpr int slot_count(const std::array<int, kSegments>& slots) noexcept
+{
+    int count = 0;
+
+    for(const int slot : slots)
+    {
+        if(slot >= 0) { ++count; }
+    }
+    return count;
+}
+
+} // namespace internal
+
+// Output of the compile-time format string `Fmt` with arguments of types
+// `Args`, rendered once into a caller buffer. Each argument field (slot)
+// is as wide as its format spec width ("{:6.1f}") and is rewritten in place
+// by update<I>(value), which only marks the slots that actually changed as
+// dirty. Use usf::make_slot_template() to create it.
+template <typename Fmt, typename... Args>
+class SlotTemplate
+{
+        using Compiled = internal::CompiledFormat<Fmt, Args...>;
+
+        static_assert(Compiled::kFormatError == error::success,
+                      "usf::SlotTemplate: invalid format string!");
+        static_assert(Compiled::kArgumentError == error::success,
+                      "usf::SlotTemplate: format spec doesn't match the argument type!");
+        static_assert(internal::slots_sized(Compiled::kProgram),
+                      "usf::SlotTemplate: every argument field needs a width!");
+
+        static constexpr auto kOffsets = internal::slot_offsets(Compiled::kProgram);
+        static constexpr auto kSlots   = internal::slot_numbers(Compiled::kProgram);
+
+        static constexpr std::size_t kSegmentCount = static_cast<std::size_t>(Compiled::kProgram.segment_count);
+
+    public:
+
+        // --------------------------------------------------------------------
+        // PUBLIC DEFINITIONS
+        // --------------------------------------------------------------------
+
+        template <std::size_t I>
+        using ArgType = typename std::tuple_element<I, std::tuple<Args...>>::type;
+
+        // Number of argument fields
+        static constexpr int kSlotCount = internal::slot_count(kSlots);
+
+        static_assert(kSlotCount <= 32, "usf::SlotTemplate: too many argument fields for the dirty mask!");
+
+        // Output size (without the null terminator)
+        static constexpr std::ptrdiff_t kSize = kOffsets[kSegmentCount];
+
+        // --------------------------------------------------------------------
+        // PUBLIC MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        // Renders the literal text and the initial argument values into
+        // `str` (at least kSize + 1 characters). All slots start dirty, the
+        // ones whose initial value is wider than the slot filled with their
+        // fill character (ec_error() returns the first error).
+        SlotTemplate(StringSpan str, const Args&... args) noexcept
+            : m_data(str.begin())
+        {
+            //USF_ENFORCE(kSize < str.size(), std::runtime_error);
+            if(kSize >= str.size()) {
+                m_data  = nullptr;
+                m_error = error::buf_overflow;
+                return;
+            }
+
+            for(std::size_t n = 0; n < kSegmentCount; ++n)
+            {
+                const auto& segment = Compiled::kProgram.segments[n];
+
+                CharType* it = m_data + kOffsets[n];
+
+                if(segment.size > 0) {
+                    internal::CharTraits::copy(it, Compiled::kProgram.chars.data() + segment.offset, segment.size);
+                } else {
+                    // Blank until rendered (a failed slot is not left as is)
+                    internal::CharTraits::assign(it, segment.format.fill_char(), segment.format.width());
+                }
+            }
+
+        #if !defined(USF_DISABLE_STRING_TERMINATION)
+            // If not disabled in configuration, null terminate the resulting string.
+            m_data[kSize] = CharType{};
+        #endif
+
+            m_error = update_all(std::index_sequence_for<Args...>{}, args...);
+            m_dirty = all_slots();
+        }
+
+        // Rewrites the slots of the argument `I` with `value`, marking the
+        // ones that changed as dirty. A value wider than its slot leaves the
+        // slot unchanged and returns error::buf_overflow.
+        template <std::size_t I>
+        error update(const ArgType<I>& value) noexcept
+        {
+            static_assert(I < sizeof...(Args), "usf::SlotTemplate::update(): invalid argument index!");
+
+            if(m_data == nullptr) {
+                return m_error;
+            }
+
+            const internal::Argument argument = internal::make_argument(value);
+
+            error err = error::success;
+
+            for(std::size_t n = 0; n < kSegmentCount; ++n)
+            {
+                const auto& segment = Compiled::kProgram.segments[n];
+
+                if(segment.size == 0 && segment.index == static_cast<int>(I))
+                {
+                    if(auto slot_err = update_slot(argument, n); slot_err != error::success) {
+                        err = slot_err;
+                    }
+                }
+            }
+            return err;
+        }
+
+        // Bit n set if the slot n (argument fields in order of appearance)
+        // changed since the last clear_dirty().
+        uint32_t dirty() const noexcept { return m_dirty; }
+
+        void clear_dirty() noexcept { m_dirty = 0; }
+
+        // Region of the slot n in the output
+        StringView slot(const int n) const noexcept
+        {
+            assert(n >= 0 && n < kSlotCount);
+
+            const std::size_t segment = slot_segment(n);
+            return StringView(m_data + kOffsets[segment], kOffsets[segment + 1] - kOffsets[segment]);
+        }
+
+        // Offset of the slot n in the output
+        std::ptrdiff_t slot_offset(const int n) const noexcept { return kOffsets[slot_segment(n)]; }
+
+        StringView view() const noexcept { return StringView(m_data, (m_data == nullptr) ? 0 : kSize); }
+
+        error ec_error() const noexcept { return m_error; }
+
+    private:
+
+        // --------------------------------------------------------------------
+        // PRIVATE STATIC FUNCTIONS
+        // --------------------------------------------------------------------
+
+        static constexpr uint32_t all_slots() noexcept
+        {
+            return (kSlotCount == 32) ? ~uint32_t{0} : (uint32_t{1} << kSlotCount) - 1;
+        }
+
+        static constexpr error first_error(const error err, const error next) noexcept
+        {
+            return (err != error::success) ? err : next;
+        }
+
+        static constexpr std::size_t slot_segment(const int n) noexcept
+        {
+            std::size_t segment = 0;
+            while(kSlots[segment] != n) { ++segment; }
+            return segment;
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER FUNCTIONS
+        // --------------------------------------------------------------------
+
+        template <std::size_t... I>
+        error update_all(std::index_sequence<I...>, const Args&... args) noexcept
+        {
+            error err = error::success;
+
+            // All rendered, the first error kept
+            static_cast<void>(((err = first_error(err, update<I>(args))), ...));
+            return err;
+        }
+
+        error update_slot(const internal::Argument& argument, const std::size_t segment) noexcept
+        {
+            internal::ArgFormat format = Compiled::kProgram.segments[segment].format;
+
+            const std::ptrdiff_t width = format.width();
+
+            // Rendered aside first: values wider than the slot don't touch
+            // the output and unchanged slots are not marked dirty.
+            CharType field[256];
+            StringSpan span(field, width + 1);
+
+            if(auto err = argument.template format<internal::Checks::kBounds>(span, format); err != error::success) {
+                return err;
+            }
+
+            //USF_ENFORCE(span.size() == 1, std::runtime_error);
+            if(span.size() != 1) {
+                return error::buf_overflow;
+            }
+
+            CharType* const slot_data = m_data + kOffsets[segment];
+
+            if(!std::equal(field, field + width, slot_data))
+            {
+                CharType* it = slot_data;
+                internal::CharTraits::copy(it, field, static_cast<int>(width));
+                m_dirty |= uint32_t{1} << kSlots[segment];
+            }
+            return error::success;
+        }
+
+        // --------------------------------------------------------------------
+        // PRIVATE MEMBER VARIABLES
+        // --------------------------------------------------------------------
+
+        CharType* m_data  = nullptr;
+        uint32_t  m_dirty = 0;
+        error     m_error = error::success;
+};
+
+} // namespace usf
@@ -0,0 +1,256 @@
+// ----------------------------------------------------------------------------
+// @file    usf_static_format.hpp
+// @brief   Formatting in constant expressions. The format string is known at
+//          compile time and the result is a constant initialized string,
+//          e.g. constexpr auto name = usf::static_format<"reg{:02d}">(7);
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tuple>
+
+namespace usf
+{
+
+// String returned by usf::static_format(). `N` is the maximum formatted
+// size of the format string (see usf::max_formatted_size()).
+template <std::size_t N>
+class StaticString
+{
+    public:
+
+        constexpr StaticString(const CharType* const str, const std::ptrdiff_t size) noexcept
+            : m_size(size)
+        {
+            for(std::ptrdiff_t n = 0; n < size; ++n) { m_data[n] = str[n]; }
+        }
+
+        // Null terminated string
+        constexpr const CharType* c_str() const noexcept { return m_data; }
+
+        constexpr std::ptrdiff_t size() const noexcept { return m_size; }
+
+        constexpr StringView view() const noexcept { return StringView(m_data, m_size); }
+
+    private:
+
+        CharType       m_data[N]{};
+        std::ptrdiff_t m_size = 0;
+};
+
+} // namespace usf
+
+namespace usf::internal
+{
+
+// Unsigned integer type used to convert a value of the integer type `T`
+// (same conversions as the make_argument() overloads).
+template <typename T>
+using StaticUnsigned = typename std::conditional<(sizeof(T) <= sizeof(uint32_t)), uint32_t,
+#if defined(USF_INT128_SUPPORT)
+                       typename std::conditional<(sizeof(T) <= sizeof(uint64_t)), uint64_t, uint128_t>::type
+#else
+                       uint64_t
+#endif
+                       >::type;
+
+template <typename T>
+constexpr int static_count_digits(T value, const unsigned base) noexcept
+{
+    int digits = 1;
+
+    while(value >= base)
+    {
+        value /= base;
+        ++digits;
+    }
+    return digits;
+}
+
+// Writes the `digits` last digits of `value` in base `base` (zero padded),
+// back to front from `it`, inserting a `separator` (if not '\0') every 3
+// digits.
+template <typename T>
+constexpr void static_convert(CharType* it, T value, const unsigned base, const int digits,
+                              const bool uppercase, const CharType separator) noexcept
+{
+    const CharType* const lut = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    for(int n = 0; n < digits; ++n)
+    {
+        if(separator != '\0' && n > 0 && n % 3 == 0) { *--it = separator; }
+
+        *--it = lut[static_cast<std::size_t>(value % base)];
+        value /= base;
+    }
+}
+
+// Same output as Argument::format_integer()
+template <typename T>
+constexpr void static_format_integer(CharType*& it, const ArgFormat& format, const T value, const bool negative) noexcept
+{
+    // Maximum number of digits of the fixed digit converters
+    constexpr bool wide = (sizeof(T) > sizeof(uint64_t));
+    constexpr int max_hex = wide ? 32 :  16;
+    constexpr int max_oct = wide ? 43 :  22;
+    constexpr int max_bin = wide ? 128 : 64;
+
+    int fill_after = 0;
+
+    if(format.type_is_none() || format.type_is_integer_dec())
+    {
+        const int digits = static_count_digits(value, 10);
+        fill_after = format.write_alignment<Checks::kNone>(it, it, digits, negative, digits);
+        it += digits + format.group_separators(digits);
+        static_convert(it, value, 10, digits, false, format.group_char());
+    }
+    else
+    {
+        const unsigned base = format.type_is_integer_hex() ? 16 : format.type_is_integer_oct() ? 8 : 2;
+        const int max_digits = (base == 16) ? max_hex : (base == 8) ? max_oct : max_bin;
+
+        const int digits = std::min(format.padded_digits(static_count_digits(value, base), negative), max_digits);
+        fill_after = format.write_alignment<Checks::kNone>(it, it, digits, negative);
+        it += digits;
+        static_convert(it, value, base, digits, format.uppercase(), '\0');
+    }
+
+    CharTraits::assign(it, format.fill_char(), fill_after);
+}
+
+// Same output as Argument::format_string()
+constexpr void static_format_string(CharType*& it, const ArgFormat& format, const CharType* const str,
+                                    const int str_length) noexcept
+{
+    const int fill_after = format.write_alignment<Checks::kNone>(it, it, str_length, false);
+
+    CharTraits::copy(it, str, str_length);
+    CharTraits::assign(it, format.fill_char(), fill_after);
+}
+
+template <typename T>
+constexpr void static_format_argument(CharType*& it, ArgFormat format, const T& value) noexcept
+{
+    using Decayed = typename std::decay<T>::type;
+
+    constexpr ArgKind kind = arg_kind<Decayed>();
+
+    // Floating point values, pointers, ranges and custom types are run time
+    // only (vectorized converters, type punning and function pointers).
+    static_assert(kind == ArgKind::kBool || kind == ArgKind::kChar || kind == ArgKind::kInteger || kind == ArgKind::kString,
+                  "usf::static_format(): only booleans, characters, integers and strings are supported!");
+
+    if constexpr(kind == ArgKind::kBool)
+    {
+        if(format.type_is_none()) {
+            static_format_string(it, format, value ? "true" : "false", value ? 4 : 5);
+        } else {
+            static_format_integer(it, format, static_cast<uint32_t>(value), false);
+        }
+    }
+    else if constexpr(kind == ArgKind::kChar)
+    {
+        if(format.type_is_none() || format.type_is_char())
+        {
+            // Characters and strings align to left by default.
+            format.default_align_left();
+
+            const int fill_after = format.write_alignment<Checks::kNone>(it, it, 1, false);
+            *it++ = value;
+            CharTraits::assign(it, format.fill_char(), fill_after);
+        }
+        else
+        {
+            const auto ivalue = static_cast<int32_t>(value);
+            const bool negative = (ivalue < 0);
+
+            static_format_integer(it, format, negative ? 0U - static_cast<uint32_t>(ivalue) : static_cast<uint32_t>(ivalue), negative);
+        }
+    }
+    else if constexpr(kind == ArgKind::kInteger)
+    {
+        using Unsigned = StaticUnsigned<Decayed>;
+
+        if constexpr(Integer::is_unsigned<Decayed>::value)
+        {
+            static_format_integer(it, format, static_cast<Unsigned>(value), false);
+        }
+        else
+        {
+            const bool negative = (value < 0);
+            const auto uvalue = static_cast<Unsigned>(value);
+
+            static_format_integer(it, format, negative ? static_cast<Unsigned>(Unsigned{0} - uvalue) : uvalue, negative);
+        }
+    }
+    else
+    {
+        const StringView str(value);
+
+        // Characters and strings align to left by default.
+        format.default_align_left();
+
+        // If precision is specified use it up to string size.
+        const int str_length = (format.precision() == -1)
+                             ? static_cast<int>(str.size())
+                             : std::min(format.precision(), static_cast<int>(str.size()));
+
+        static_format_string(it, format, str.data(), str_length);
+    }
+}
+
+// Runs the segment `I` of a compiled format string.
+template <typename Compiled, std::size_t I, typename Args>
+constexpr void static_run_segment(CharType*& it, const Args& args) noexcept
+{
+    constexpr auto& segment = Compiled::kProgram.segments[I];
+
+    if constexpr(segment.size > 0)
+    {
+        CharTraits::copy(it, Compiled::kProgram.chars.data() + segment.offset, segment.size);
+    }
+    else
+    {
+        static_format_argument(it, segment.format, arg_value(std::get<static_cast<std::size_t>(segment.index)>(args)));
+    }
+}
+
+template <typename Compiled, typename Args, std::size_t... I>
+constexpr void static_process(CharType*& it, [[maybe_unused]] const Args& args, std::index_sequence<I...>) noexcept
+{
+    (static_run_segment<Compiled, I>(it, args), ...);
+}
+
+// Escaped strings ("{:?}") are run time only (vectorized escaping).
+template <typename Program>
+constexpr bool has_debug_fields(const Program& program) noexcept
+{
+    for(int n = 0; n < program.segment_count; ++n)
+    {
+        const auto& segment = program.segments[static_cast<std::size_t>(n)];
+        if(segment.size == 0 && segment.format.type_is_debug()) { return true; }
+    }
+    return false;
+}
+
+template <typename Fmt, typename... Args>
+constexpr auto static_format(const Args&... args) noexcept
+{
+    using Compiled = CompiledFormat<Fmt, typename std::decay<Args>::type...>;
+
+    static_assert(!has_debug_fields(Compiled::kProgram),
+                  "usf::static_format(): escaped strings (\"{:?}\") are run time only!");
+
+    // The output size is bounded, as checked by MaxFormattedSize.
+    constexpr auto kSize = static_cast<std::size_t>(MaxFormattedSize<Fmt, Args...>::kValue);
+
+    CharType str[kSize]{};
+    CharType* it = str;
+
+    static_process<Compiled>(it, std::forward_as_tuple(args...), typename Compiled::Segments{});
+
+    return StaticString<kSize>(str, it - str);
+}
+
+} // namespace usf::internal
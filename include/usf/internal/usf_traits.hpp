@@ -39,6 +39,14 @@ namespace usf::internal::CharTraits
         return str - str_begin;
     }
 
+    template <typename CharT> inline static constexpr
+    bool equal(const CharT* str1, const CharT* str2, std::ptrdiff_t count) noexcept
+    {
+        while((count--) > 0) { if(*str1++ != *str2++) { return false; } }
+
+        return true;
+    }
+
 
 
 template <typename T>
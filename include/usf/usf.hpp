@@ -16,12 +16,25 @@
 #include "usf/internal/usf_string_span.hpp"
 #include "usf/internal/usf_result.hpp"
 #include "usf/internal/usf_string_view.hpp"
+#include "usf/internal/usf_compile_string.hpp"
 #include "usf/internal/usf_integer.hpp"
 #include "usf/internal/usf_float.hpp"
+#include "usf/internal/usf_encoding.hpp"
 #include "usf/internal/usf_arg_format.hpp"
 #include "usf/internal/usf_arg_custom_type.hpp"
+#include "usf/internal/usf_arg_range.hpp"
+#include "usf/internal/usf_arg_named.hpp"
 #include "usf/internal/usf_argument.hpp"
+#include "usf/internal/usf_format_string.hpp"
+#include "usf/internal/usf_static_format.hpp"
+#include "usf/internal/usf_slot_template.hpp"
 #include "usf/internal/usf_main.hpp"
+#include "usf/internal/usf_scatter.hpp"
+#include "usf/internal/usf_ring_sink.hpp"
+#include "usf/internal/usf_mpsc_sink.hpp"
+#include "usf/internal/usf_parse.hpp"
+#include "usf/internal/usf_scan.hpp"
+#include "usf/internal/usf_json_writer.hpp"
 
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC pop_options
@@ -0,0 +1,350 @@
+// ----------------------------------------------------------------------------
+// @file    usf_posix.hpp
+// @brief   Output sinks for POSIX systems (file descriptors and files).
+//          Optional, not included by usf.hpp.
+// @date    19 October 2026
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "usf/usf.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace usf::posix
+{
+
+// Writes all the pieces of `iov` to the file descriptor `fd` with writev(),
+// resuming partial writes. Returns the number of bytes written or
+// error::io_error (errno set by writev()).
+[[nodiscard]] ssize_t write_iov(const int fd, const IoVec* const iov, const int count) noexcept;
+
+// Formats straight to a file descriptor with scatter-gather output: the
+// literal text is written from the format string and only the argument
+// fields are rendered (into a `kScratchSize` stack buffer).
+template <int kMaxIov = 16, std::ptrdiff_t kScratchSize = 256>
+class WritevSink
+{
+    public:
+
+        explicit WritevSink(const int fd) noexcept : m_fd(fd) {}
+
+        // Returns the number of bytes written or a negative error code.
+        template <typename... Args>
+        ssize_t format(StringView fmt, Args&&... args) const noexcept
+        {
+            IoVec      iov[static_cast<std::size_t>(kMaxIov)];
+            CharType   scratch[static_cast<std::size_t>(kScratchSize)];
+            IoVecSpan  span(iov);
+
+            if(const ssize_t size = format_to_iov(span, StringSpan(scratch, kScratchSize), fmt, args...); size < 0) {
+                return size;
+            }
+            return write_iov(m_fd, span.data(), span.count());
+        }
+
+        int fd() const noexcept { return m_fd; }
+
+    private:
+
+        int m_fd;
+};
+
+// Log file sink formatting straight into a memory-mapped file. Writers
+// reserve a record with a compare-and-swap of the append offset, format
+// into it and commit it (reserve-then-commit), from any number of threads.
+// The file is grown in steps as needed (before the record is reserved, a
+// failure reserves nothing), up to a fixed capacity.
+//
+// File layout: a 64 bytes header (magic and committed length) followed by
+// the records, each an 8 bytes header (reserved and used sizes) and the
+// formatted text, 8 bytes aligned. The committed length only covers
+// complete records, in order, so the file reads back consistently after a
+// crash: open() drops what follows the committed length.
+//
+// format() gives the space reserved but not used back when no other record
+// was reserved meanwhile, so the records of a single writer take their
+// formatted size (plus header and alignment) whatever the reservation.
+class MmapSink
+{
+    public:
+
+        // Reserved record, see reserve().
+        struct Record
+        {
+            StringSpan    span;
+            std::uint64_t offset;
+        };
+
+        MmapSink() noexcept = default;
+        ~MmapSink() { close(); }
+
+        MmapSink(const MmapSink&) = delete;
+        MmapSink& operator=(const MmapSink&) = delete;
+
+        // Opens (or creates) the file at `path`, mapping up to `capacity`
+        // bytes. The file grows by `grow_step` bytes and the run time format
+        // strings records reserve `max_record` characters (the space not used
+        // is given back, see above).
+        [[nodiscard]] error open(const char* path, std::size_t capacity,
+                                 std::size_t grow_step = 1 << 20, std::ptrdiff_t max_record = 256) noexcept;
+
+        // Truncates the file to the committed records and closes it.
+        void close() noexcept;
+
+        // Reserves a record of `size` characters. Each reserved record must
+        // be committed, the records that follow are not committed before.
+        [[nodiscard]] std::pair<error, Record> reserve(std::ptrdiff_t size) noexcept;
+
+        // Commits the first `used` characters of `record`.
+        void commit(const Record& record, std::ptrdiff_t used) noexcept;
+
+        // Returns the formatted size or a negative error code (the record is
+        // committed empty).
+        template <typename... Args>
+        ssize_t format(StringView fmt, Args&&... args) noexcept
+        {
+            return format_record(m_max_record, [&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        // Compile-time format strings with bounded arguments reserve their
+        // maximum formatted size (see usf::max_formatted_size()).
+        template <typename Fmt, typename... Args,
+                  typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+        ssize_t format(Fmt fmt, Args&&... args) noexcept
+        {
+            using Compiled = internal::CompiledFormat<Fmt, typename std::decay<Args>::type...>;
+
+            constexpr bool kBounded = internal::all_bounded(Compiled::kSegmentSizes);
+            const std::ptrdiff_t size = kBounded ? internal::bounded_size(Compiled::kSegmentSizes) : m_max_record;
+
+            return format_record(size, [&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        // Calls `func(StringView)` with each committed record, in order.
+        template <typename Func>
+        void for_each_record(Func&& func) const
+        {
+            const std::uint64_t committed = this->committed();
+
+            for(std::uint64_t offset = 0; offset < committed; offset += record_size(header(offset)->size))
+            {
+                const RecordHeader* const record = header(offset);
+                const std::ptrdiff_t used = record->state.load(std::memory_order_acquire) & ~kCommitted;
+
+                if(used > 0) {
+                    func(StringView(reinterpret_cast<const CharType*>(record + 1), used));
+                }
+            }
+        }
+
+        // Length of the records committed (the header aside)
+        std::uint64_t committed() const noexcept
+        {
+            return (m_committed != nullptr) ? m_committed->load(std::memory_order_acquire) : 0;
+        }
+
+        // Flushes the mapped file to the storage (msync).
+        [[nodiscard]] error sync() noexcept;
+
+    private:
+
+        struct RecordHeader
+        {
+            std::atomic<std::uint32_t> state;   // Used size | kCommitted
+            std::uint32_t              size;    // Reserved size
+        };
+
+        static_assert(std::atomic<std::uint32_t>::is_always_lock_free && std::atomic<std::uint64_t>::is_always_lock_free,
+                      "usf::posix::MmapSink: lock-free atomics are needed in shared memory!");
+
+        static constexpr std::uint32_t kCommitted  = 0x80000000U;
+        static constexpr std::uint64_t kHeaderSize = 64;
+
+        static constexpr std::uint64_t record_size(const std::uint64_t size) noexcept
+        {
+            return (sizeof(RecordHeader) + size + 7) & ~std::uint64_t{7};
+        }
+
+        RecordHeader* header(const std::uint64_t offset) const noexcept
+        {
+            // Records are 8 bytes aligned in the page aligned mapping
+            return static_cast<RecordHeader*>(static_cast<void*>(m_map + kHeaderSize + offset));
+        }
+
+        template <typename Formatter>
+        ssize_t format_record(const std::ptrdiff_t size, Formatter&& formatter) noexcept
+        {
+            const auto [err, record] = reserve(size);
+            if(err != error::success) {
+                return ssize_t(err);
+            }
+
+            const auto [format_err, str] = formatter(record.span);
+
+            if(format_err == error::success) {
+                shrink(record, str.size());
+            }
+
+            commit(record, (format_err == error::success) ? str.size() : 0);
+            return (format_err == error::success) ? ssize_t(str.size()) : ssize_t(format_err);
+        }
+
+        [[nodiscard]] error grow(std::uint64_t size) noexcept;
+
+        // Shrinks `record` (not committed yet) to `used` characters if it's
+        // still the last record reserved. Nothing but the null terminator
+        // may be written past them.
+        void shrink(const Record& record, std::ptrdiff_t used) noexcept;
+
+        // Advances the committed length over the committed records.
+        void advance() noexcept;
+
+        int                         m_fd         = -1;
+        CharType*                   m_map        = nullptr;
+        std::uint64_t               m_capacity   = 0;   // Record space
+        std::uint64_t               m_grow_step  = 0;
+        std::ptrdiff_t              m_max_record = 0;
+        std::atomic<std::uint64_t>* m_committed  = nullptr;
+        std::atomic<std::uint64_t>  m_reserved{0};
+        std::atomic<std::uint64_t>  m_file_size{0};
+        std::mutex                  m_grow_mutex{};
+};
+
+// AsyncFileSink settings
+struct AsyncFileConfig
+{
+    // What format() does when all the buffers wait for the flusher
+    enum class Overflow : uint8_t
+    {
+        kBlock,     // Waits for a buffer to be flushed
+        kDrop       // Drops the record, returns error::backpressure
+    };
+
+    std::ptrdiff_t            buffer_size     = 64 * 1024;
+    int                       buffer_count    = 2;
+    std::ptrdiff_t            flush_threshold = 48 * 1024;  // Buffer handed to the flusher at this size
+    std::chrono::milliseconds flush_interval{100};          // Partially filled buffers flushed at least as often
+    Overflow                  overflow        = Overflow::kBlock;
+};
+
+// File descriptor sink formatting into one of `buffer_count` buffers while
+// a background thread writes the others, so the formatting threads never
+// wait for the I/O (unless all the buffers are full, see Overflow).
+class AsyncFileSink
+{
+    public:
+
+        explicit AsyncFileSink(int fd, const AsyncFileConfig& config = AsyncFileConfig{});
+        ~AsyncFileSink();
+
+        AsyncFileSink(const AsyncFileSink&) = delete;
+        AsyncFileSink& operator=(const AsyncFileSink&) = delete;
+
+        // Returns the formatted size or a negative error code:
+        // error::backpressure if dropped, error::buf_overflow if larger than
+        // a buffer, error::io_error after a failed write.
+        template <typename... Args>
+        ssize_t format(StringView fmt, Args&&... args)
+        {
+            return format_record([&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        template <typename Fmt, typename... Args,
+                  typename std::enable_if<internal::is_compile_string<Fmt>::value, bool>::type = true>
+        ssize_t format(Fmt fmt, Args&&... args)
+        {
+            return format_record([&](StringSpan span) { return basic_format_to(span, fmt, args...); });
+        }
+
+        // Waits until everything formatted so far is written.
+        [[nodiscard]] error flush();
+
+        // Number of records dropped (Overflow::kDrop)
+        std::uint64_t dropped() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+
+        struct Buffer
+        {
+            std::unique_ptr<CharType[]> data{};
+            std::ptrdiff_t              size = 0;
+        };
+
+        template <typename Formatter>
+        ssize_t format_record(Formatter&& formatter)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            if(m_io_error) {
+                return ssize_t(error::io_error);
+            }
+
+            // A second attempt in an empty buffer if the current one is full
+            for(int attempt = 0; attempt < 2; ++attempt)
+            {
+                if(m_active < 0)
+                {
+                    if(auto err = acquire(lock); err != error::success) {
+                        return ssize_t(err);
+                    }
+                }
+
+                Buffer& buffer = m_buffers[static_cast<std::size_t>(m_active)];
+
+                const auto [err, str] = formatter(StringSpan(buffer.data.get() + buffer.size, m_config.buffer_size - buffer.size));
+
+                if(err == error::success)
+                {
+                    buffer.size += str.size();
+                    if(buffer.size >= m_config.flush_threshold) {
+                        submit();
+                    }
+                    return ssize_t(str.size());
+                }
+
+                if(err != error::buf_overflow || buffer.size == 0) {
+                    return ssize_t(err);
+                }
+                submit();
+            }
+            return ssize_t(error::buf_overflow);
+        }
+
+        // Takes a free buffer as the active buffer.
+        error acquire(std::unique_lock<std::mutex>& lock);
+
+        // Hands the active buffer to the flusher.
+        void submit();
+
+        void run();
+
+        const int             m_fd;
+        const AsyncFileConfig m_config;
+
+        std::vector<Buffer> m_buffers;
+        std::vector<int>    m_free;         // Free buffers (stack)
+        std::vector<int>    m_full;         // Buffers to write (queue)
+        std::size_t         m_full_head = 0;
+        std::size_t         m_full_count = 0;
+        int                 m_active  = -1;
+        bool                m_writing = false;
+        bool                m_flush   = false;
+        bool                m_stop    = false;
+        bool                m_io_error = false;
+
+        std::atomic<std::uint64_t> m_dropped{0};
+
+        std::mutex              m_mutex;
+        std::condition_variable m_flusher_cv;   // Work for the flusher
+        std::condition_variable m_writer_cv;    // Buffer written
+        std::thread             m_thread;
+};
+
+} // namespace usf::posix
@@ -2,31 +2,49 @@
 
 namespace usf::internal {
 
+        template <Checks kChecks>
         error Argument::format(usf::StringSpan& dst, ArgFormat& format) const
         {
-            if(format.ec_error()!=error::success) {
-                return format.ec_error();
+            if constexpr(kChecks == Checks::kAll)
+            {
+                if(format.ec_error()!=error::success) {
+                    return format.ec_error();
+                }
+
+                // Digit grouping is only valid for integer and floating point types
+                if(format.grouping() && !is_numeric()) {
+                    return error::inv_format;
+                }
             }
             iterator it = dst.begin();
             error ret { error::success };
+
             switch(m_type_id)
             {
-                case TypeId::kBool:    ret = format_bool   (it, dst.end(), format, m_bool   ); break;
-                case TypeId::kChar:    ret = format_char   (it, dst.end(), format, m_char   ); break;
-                case TypeId::kInt32:   ret = format_integer(it, dst.end(), format, m_int32  ); break;
-                case TypeId::kUint32:  ret = format_integer(it, dst.end(), format, m_uint32 ); break;
-                case TypeId::kInt64:   ret = format_integer(it, dst.end(), format, m_int64  ); break;
-                case TypeId::kUint64:  ret = format_integer(it, dst.end(), format, m_uint64 ); break;
-                case TypeId::kPointer: ret = format_pointer(it, dst.end(), format, m_pointer); break;
+                case TypeId::kBool:    ret = format_bool<kChecks>(it, dst.end(), format, m_bool   ); break;
+                case TypeId::kChar:    ret = format_char<kChecks>(it, dst.end(), format, m_char   ); break;
+                case TypeId::kInt32:   ret = format_integer<kChecks>(it, dst.end(), format, m_int32  ); break;
+                case TypeId::kUint32:  ret = format_integer<kChecks>(it, dst.end(), format, m_uint32 ); break;
+                case TypeId::kInt64:   ret = format_integer<kChecks>(it, dst.end(), format, m_int64  ); break;
+                case TypeId::kUint64:  ret = format_integer<kChecks>(it, dst.end(), format, m_uint64 ); break;
+#if defined(USF_INT128_SUPPORT)
+                case TypeId::kInt128:  ret = format_integer<kChecks>(it, dst.end(), format, *m_int128 ); break;
+                case TypeId::kUint128: ret = format_integer<kChecks>(it, dst.end(), format, *m_uint128); break;
+#endif
+                case TypeId::kPointer: ret = format_pointer<kChecks>(it, dst.end(), format, m_pointer); break;
 #if !defined(USF_DISABLE_FLOAT_SUPPORT)
-                case TypeId::kFloat:   ret = format_float  (it, dst.end(), format, m_float  ); break;
+                case TypeId::kFloat:   ret = format_float<kChecks>(it, dst.end(), format, m_float  ); break;
 #endif
-                case TypeId::kString:  ret = format_string (it, dst.end(), format, m_string ); break;
+                case TypeId::kString:  ret = format_string<kChecks>(it, dst.end(), format, m_string ); break;
+                case TypeId::kIntegerRange:
+                                       ret = format_integer_range<kChecks>(it, dst.end(), format, *m_integer_range); break;
+                case TypeId::kByteRange:
+                                       ret = format_byte_range<kChecks>(it, dst.end(), format, *m_byte_range); break;
                 /*
                 case TypeId::kCustom:  USF_ENFORCE(format.is_empty(), std::runtime_error);
                                        it = m_custom(dst).end();                         break;
                 */
-                case TypeId::kCustom:  if(format.is_empty()) {
+                case TypeId::kCustom:  if(kChecks != Checks::kAll || format.is_empty()) {
                                         auto [err,span] = m_custom(dst);
                                         ret = err;
                                         if(ret==error::success) 
@@ -43,40 +61,49 @@ namespace usf::internal {
             return ret;
         }
 
+        template <Checks kChecks>
         error Argument::format_bool(iterator& it, const_iterator end,
                                                     const ArgFormat& format, const bool value)
         {
-            if(format.ec_error()!=error::success) {
-                return format.ec_error();
-            }
-            if(format.type_is_none())
+            if constexpr(kChecks == Checks::kAll)
             {
-                return format_string(it, end, format, value ? "true" : "false", value ? 4 : 5);
-            }
-            else if(format.type_is_integer())
-            {
-                return format_integer(it, end, format, static_cast<uint32_t>(value));
+                if(format.ec_error()!=error::success) {
+                    return format.ec_error();
+                }
+                if(!(format.type_is_none() || format.type_is_integer())) {
+                    // Argument type / format mismatch
+                    //USF_CONTRACT_VIOLATION(std::runtime_error);
+                    return error::type_mismatch;
+                }
             }
-            else
+            if(format.type_is_none())
             {
-                // Argument type / format mismatch
-                //USF_CONTRACT_VIOLATION(std::runtime_error);
-                return error::type_mismatch;
+                return format_string<kChecks>(it, end, format, value ? "true" : "false", value ? 4 : 5);
             }
+            return format_integer<kChecks>(it, end, format, static_cast<uint32_t>(value));
         }
 
+        template <Checks kChecks>
         error Argument::format_char(iterator& it, const_iterator end,
                                                     ArgFormat& format, const CharType value)
         {
-            if(format.ec_error()!=error::success) {
-                return format.ec_error();
+            if constexpr(kChecks == Checks::kAll)
+            {
+                if(format.ec_error()!=error::success) {
+                    return format.ec_error();
+                }
+                if(!(format.type_is_none() || format.type_is_char() || format.type_is_integer())) {
+                    // Argument type / format mismatch
+                    //USF_CONTRACT_VIOLATION(std::runtime_error);
+                    return error::type_mismatch;
+                }
             }
             if(format.type_is_none() || format.type_is_char())
             {
                 // Characters and strings align to left by default.
                 format.default_align_left();
 
-                const int fill_after = format.write_alignment(it, end, 1, false);
+                const int fill_after = format.write_alignment<kChecks>(it, end, 1, false);
                 if(fill_after<0) {
                     return error::buf_overflow;
                 }
@@ -84,63 +111,84 @@ namespace usf::internal {
                 CharTraits::assign(it, format.fill_char(), fill_after);
                 return error::success;
             }
-            else if(format.type_is_integer())
-            {
-                return format_integer(it, end, format, static_cast<int32_t>(value));
-            }
-            else
-            {
-                // Argument type / format mismatch
-                //USF_CONTRACT_VIOLATION(std::runtime_error);
-                return error::type_mismatch;
-            }
+            return format_integer<kChecks>(it, end, format, static_cast<int32_t>(value));
         }
+        template <Checks kChecks>
         error Argument::format_pointer(iterator& it, const_iterator end,
-                                                       const ArgFormat& format, const std::uintptr_t value) const
+                                                       const ArgFormat& format, const std::uintptr_t value)
         {
-            if(format.ec_error()!=error::success) {
-                return format.ec_error();
-            }
-            if(format.type_is_none() || format.type_is_pointer())
+            if constexpr(kChecks == Checks::kAll)
             {
+                if(format.ec_error()!=error::success) {
+                    return format.ec_error();
+                }
+                if(!(format.type_is_none() || format.type_is_pointer())) {
+                    // Argument type / format mismatch
+                    //USF_CONTRACT_VIOLATION(std::runtime_error);
+                    return error::type_mismatch;
+                }
+            }
 #if defined(USF_TARGET_64_BITS)
-                const auto ivalue = static_cast<uint64_t>(value);
+            const auto ivalue = static_cast<uint64_t>(value);
 #else
-                const auto ivalue = static_cast<uint32_t>(value);
+            const auto ivalue = static_cast<uint32_t>(value);
 #endif
-                const auto digits = Integer::count_digits_hex(ivalue);
-                const auto fill_after = format.write_alignment(it, end, digits, false);
-                if(fill_after<0) {
-                    return error::buf_overflow;
-                }
-                it += digits;
-                Integer::convert_hex(it, ivalue, format.uppercase());
-                CharTraits::assign(it, format.fill_char(), fill_after);
-                return error::success;
+            const auto digits = std::min(format.padded_digits(Integer::count_digits_hex(ivalue), false), 16);
+            const auto fill_after = format.write_alignment<kChecks>(it, end, digits, false);
+            if(fill_after<0) {
+                return error::buf_overflow;
             }
-            else
+            it += digits;
+            Integer::convert_hex(it, ivalue, format.uppercase(), digits);
+            CharTraits::assign(it, format.fill_char(), fill_after);
+            return error::success;
+        }
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+
+        // Copies the `digits` integer part digits of a significand of `size`
+        // characters (zero padded when shorter), inserting a `separator`
+        // every 3 digits.
+        static void copy_grouped(CharType*& it, const CharType* significand, const int size,
+                                 const int digits, const CharType separator) noexcept
+        {
+            // Digits left before the next separator ((digits - 1) % 3 + 1)
+            int group = digits - 3 * (((digits - 1) * 43) >> 7);
+
+            for(int n = 0; n < digits; ++n)
             {
-                // Argument type / format mismatch
-                //USF_CONTRACT_VIOLATION(std::runtime_error);
-                return error::type_mismatch;
+                if(group == 0)
+                {
+                    *it++ = separator;
+                    group = 3;
+                }
+                *it++ = (n < size) ? significand[n] : '0';
+                --group;
             }
         }
-#if !defined(USF_DISABLE_FLOAT_SUPPORT)
-        
+
+        template <Checks kChecks>
         error Argument::format_float(iterator& it, const_iterator end, const ArgFormat& format, double value) 
         {
-            if(format.ec_error()!=error::success) {
-                return format.ec_error();
-            }
-            // Test for argument type / format match
-            //USF_ENFORCE(format.type_is_none() || format.type_is_float(), std::runtime_error);
-            if(!(format.type_is_none() || format.type_is_float())) {
-                return error::type_mismatch;
+            if constexpr(kChecks == Checks::kAll)
+            {
+                if(format.ec_error()!=error::success) {
+                    return format.ec_error();
+                }
+                // Test for argument type / format match
+                //USF_ENFORCE(format.type_is_none() || format.type_is_float(), std::runtime_error);
+                if(!(format.type_is_none() || format.type_is_float())) {
+                    return error::type_mismatch;
+                }
+                // Digit grouping is only valid for the fixed point format
+                //USF_ENFORCE(!format.grouping() || format.type_is_float_fixed(), std::runtime_error);
+                if(format.grouping() && !format.type_is_float_fixed()) {
+                    return error::inv_format;
+                }
             }
 
             if(std::isnan(value))
             {
-                if( auto err = format_string(it, end, format, format.uppercase() ? "NAN" : "nan", 3); err!=error::success ) {
+                if( auto err = format_string<kChecks>(it, end, format, format.uppercase() ? "NAN" : "nan", 3); err!=error::success ) {
                     return err;
                 }
             }
@@ -150,7 +198,7 @@ namespace usf::internal {
 
                 if(std::isinf(value))
                 {
-                    if( auto err = format_string(it, end, format, format.uppercase() ? "INF" : "inf", 3, negative); err!=error::success) {
+                    if( auto err = format_string<kChecks>(it, end, format, format.uppercase() ? "INF" : "inf", 3, negative); err!=error::success) {
                         return err;
                     }
                 }
@@ -171,7 +219,9 @@ namespace usf::internal {
 
                     if(fp_value.i == 0)
                     {
-                        format_float_zero(it, end, format, negative);
+                        if(auto err=format_float_zero<kChecks>(it, end, format, negative); err!=error::success) {
+                            return err;
+                        }
                     }
                     else if(value >= 1E-19 && value <= 1.8446744E19)
                     {
@@ -220,7 +270,7 @@ namespace usf::internal {
                                 // 0.<0>SIGNIFICAND[0:N]<0>
 
                                 const int full_digits = precision + 2;
-                                fill_after = format.write_alignment(it, end, full_digits, negative);
+                                fill_after = format.write_alignment<kChecks>(it, end, full_digits, negative);
                                 if(fill_after<0) {
                                     return error::buf_overflow;
                                 }
@@ -238,20 +288,28 @@ namespace usf::internal {
                             }
                             else
                             {
+                                const int ipart_digits = exponent + 1;
+
                                 const int full_digits = exponent + 1 + precision + static_cast<int>(precision > 0 || format.hash());
-                                fill_after = format.write_alignment(it, end, full_digits, negative);
+                                fill_after = format.write_alignment<kChecks>(it, end, full_digits, negative, ipart_digits);
                                 if(fill_after<0) {
                                     return error::buf_overflow;
                                 }
 
-                                const int ipart_digits = exponent + 1;
+                                if(format.grouping())
+                                {
+                                    copy_grouped(it, significand, significand_size, ipart_digits, format.group_char());
+                                }
 
                                 if(ipart_digits >= significand_size)
                                 {
                                     // [SIGNIFICAND]<0><.><0>
 
-                                    CharTraits::copy(it, significand, significand_size);
-                                    CharTraits::assign(it, '0', ipart_digits - significand_size);
+                                    if(!format.grouping())
+                                    {
+                                        CharTraits::copy(it, significand, significand_size);
+                                        CharTraits::assign(it, '0', ipart_digits - significand_size);
+                                    }
 
                                     if(precision > 0 || format.hash())
                                     {
@@ -267,7 +325,10 @@ namespace usf::internal {
                                 {
                                     // SIGNIFICAND[0:x].SIGNIFICAND[x:N]<0>
 
-                                    CharTraits::copy(it, significand, ipart_digits);
+                                    if(!format.grouping())
+                                    {
+                                        CharTraits::copy(it, significand, ipart_digits);
+                                    }
                                     *it++ = '.';
 
                                     const int copy_size = significand_size - ipart_digits;
@@ -286,7 +347,7 @@ namespace usf::internal {
                             // SIGNIFICAND[0].SIGNIFICAND[1:N]<0>eEXP
 
                             const int full_digits = 5 + precision + static_cast<int>(precision > 0 || format.hash());
-                            fill_after = format.write_alignment(it, end, full_digits, negative);
+                            fill_after = format.write_alignment<kChecks>(it, end, full_digits, negative);
                             if(fill_after<0) {
                                 return error::buf_overflow;
                             }
@@ -311,7 +372,7 @@ namespace usf::internal {
                     }
                     else
                     {
-                        if(auto err=format_string(it, end, format, format.uppercase() ? "OVF" : "ovf", 3, negative); err!=error::success) {
+                        if(auto err=format_string<kChecks>(it, end, format, format.uppercase() ? "OVF" : "ovf", 3, negative); err!=error::success) {
                             return err;
                         }
                     }
@@ -353,11 +414,9 @@ namespace usf::internal {
             }
         }
 
-        void Argument::format_float_zero(iterator& it, const_iterator end, const ArgFormat& format, const bool negative)
+        template <Checks kChecks>
+        error Argument::format_float_zero(iterator& it, const_iterator end, const ArgFormat& format, const bool negative)
         {
-            if(format.ec_error()!=error::success) {
-                return;
-            }
             int precision = 0;
 
             if(format.type_is_float_fixed() || format.type_is_float_scientific())
@@ -371,7 +430,10 @@ namespace usf::internal {
 
             if(format.type_is_float_scientific()) { digits += 4; }
 
-            const int fill_after = format.write_alignment(it, end, digits, negative);
+            const int fill_after = format.write_alignment<kChecks>(it, end, digits, negative);
+            if(fill_after<0) {
+                return error::buf_overflow;
+            }
 
             *it++ = '0';
 
@@ -390,19 +452,24 @@ namespace usf::internal {
             }
 
             CharTraits::assign(it, format.fill_char(), fill_after);
+            return error::success;
         }
 #endif // !defined(USF_DISABLE_FLOAT_SUPPORT)
 
+        template <Checks kChecks>
         error Argument::format_string(iterator& it, const_iterator end,
-                                                      ArgFormat& format, const usf::StringView& str) const
+                                                      ArgFormat& format, const usf::StringView& str)
         {
-            if(format.ec_error()!=error::success) {
-                return format.ec_error();
-            }
-            // Test for argument type / format match
-            //USF_ENFORCE(format.type_is_none() || format.type_is_string(), std::runtime_error);
-            if( !(format.type_is_none() || format.type_is_string()) ) {
-                return error::arg_type;
+            if constexpr(kChecks == Checks::kAll)
+            {
+                if(format.ec_error()!=error::success) {
+                    return format.ec_error();
+                }
+                // Test for argument type / format match
+                //USF_ENFORCE(format.type_is_none() || format.type_is_string() || format.type_is_debug(), std::runtime_error);
+                if( !(format.type_is_none() || format.type_is_string() || format.type_is_debug()) ) {
+                    return error::arg_type;
+                }
             }
 
             // Characters and strings align to left by default.
@@ -413,6 +480,117 @@ namespace usf::internal {
                                  ? static_cast<int>(str.size())
                                  : std::min(static_cast<int>(format.precision()), static_cast<int>(str.size()));
 
-            return format_string(it, end, format, str.data(), str_length);
+            if(format.type_is_debug())
+            {
+                // Quoted and escaped ("{:?}"), the field width includes the
+                // quotes and the escape sequences.
+                const std::ptrdiff_t size = Encoding::escaped_size(str.data(), str_length);
+
+                //USF_ENFORCE(size + 2 < end - it, std::runtime_error);
+                if(kChecks != Checks::kNone && size + 2 >= end - it) {
+                    return error::buf_overflow;
+                }
+
+                const int fill_after = format.write_alignment<kChecks>(it, end, static_cast<int>(size + 2), false);
+                if(fill_after<0) {
+                    return error::buf_overflow;
+                }
+
+                *it++ = '"';
+                Encoding::convert_escaped(it, str.data(), str_length);
+                it += size;
+                *it++ = '"';
+
+                CharTraits::assign(it, format.fill_char(), fill_after);
+                return error::success;
+            }
+
+            return format_string<kChecks>(it, end, format, str.data(), str_length);
+        }
+
+        template <Checks kChecks>
+        error Argument::format_integer_range(iterator& it, const_iterator end,
+                                             const ArgFormat& format, const IntegerRange& range)
+        {
+            if constexpr(kChecks == Checks::kAll)
+            {
+                // Test for argument type / format match
+                if(!(format.type_is_none() || format.type_is_integer_dec())) {
+                    return error::type_mismatch;
+                }
+                if(format.sign() != ArgFormat::Sign::kNone) {
+                    return error::inv_sign;
+                }
+            }
+
+            const std::ptrdiff_t separators = (range.size > 1) ? range.size - 1 : 0;
+            const std::ptrdiff_t size = Integer::count_digits_dec(range.data, range.size)
+                                      + separators * range.separator.size();
+
+            if(size >= end - it) {
+                return error::buf_overflow;
+            }
+
+            const int fill_after = format.write_alignment<kChecks>(it, end, static_cast<int>(size), false);
+            if(fill_after<0) {
+                return error::buf_overflow;
+            }
+            it += size;
+            Integer::convert_dec(it, range.data, range.size, range.separator);
+            CharTraits::assign(it, format.fill_char(), fill_after);
+            return error::success;
+        }
+
+        template <Checks kChecks>
+        error Argument::format_byte_range(iterator& it, const_iterator end,
+                                          const ArgFormat& format, const ByteRange& range)
+        {
+            const bool base64 = (range.layout == ByteRange::Layout::kBase64);
+
+            // Test for argument type / format match. The layout is only known
+            // at run time, so the type is always tested against it.
+            if(!(format.type_is_none() || (base64 ? format.type_is_string() : format.type_is_integer_hex()))) {
+                return error::type_mismatch;
+            }
+            if constexpr(kChecks == Checks::kAll)
+            {
+                if(format.sign() != ArgFormat::Sign::kNone) {
+                    return error::inv_sign;
+                }
+            }
+
+            std::ptrdiff_t size = 0;
+            switch(range.layout)
+            {
+                case ByteRange::Layout::kHex:     size = Encoding::hex_size(range.size, range.separator); break;
+                case ByteRange::Layout::kHexDump: size = Encoding::hexdump_size(range.size); break;
+                case ByteRange::Layout::kBase64:  size = Encoding::base64_size(range.size); break;
+            }
+
+            if(size >= end - it) {
+                return error::buf_overflow;
+            }
+
+            const int fill_after = format.write_alignment<kChecks>(it, end, static_cast<int>(size), false);
+            if(fill_after<0) {
+                return error::buf_overflow;
+            }
+
+            switch(range.layout)
+            {
+                case ByteRange::Layout::kHex:
+                    Encoding::convert_hex(it, range.data, range.size, range.separator, format.uppercase()); break;
+                case ByteRange::Layout::kHexDump:
+                    Encoding::convert_hexdump(it, range.data, range.size, format.uppercase()); break;
+                case ByteRange::Layout::kBase64:
+                    Encoding::convert_base64(it, range.data, range.size); break;
+            }
+            it += size;
+            CharTraits::assign(it, format.fill_char(), fill_after);
+            return error::success;
         }
-}
\ No newline at end of file
+
+        template error Argument::format<Checks::kAll   >(usf::StringSpan& dst, ArgFormat& format) const;
+        template error Argument::format<Checks::kBounds>(usf::StringSpan& dst, ArgFormat& format) const;
+        template error Argument::format<Checks::kNone  >(usf::StringSpan& dst, ArgFormat& format) const;
+}
@@ -0,0 +1,420 @@
+#include <usf/usf.hpp>
+#include <cstring>
+#if defined(USF_SIMD_SSSE3)
+#include <tmmintrin.h>
+#elif defined(USF_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace usf::internal::Encoding {
+
+        // -------- HEXADECIMAL -----------------------------------------------
+
+        static constexpr char hex_lower_lut[] = "0123456789abcdef";
+        static constexpr char hex_upper_lut[] = "0123456789ABCDEF";
+
+        static inline void write_hex_byte(CharType*& dst, const uint8_t byte, const char* const lut) noexcept
+        {
+            *dst++ = static_cast<CharType>(lut[byte >> 4U]);
+            *dst++ = static_cast<CharType>(lut[byte & 0x0FU]);
+        }
+
+#if defined(USF_SIMD_SSE2)
+        // 16 bytes to 32 hexadecimal characters. The nibbles are interleaved
+        // high first and mapped to ASCII with a single compare / select.
+        static inline void convert_hex16(CharType* const dst, const uint8_t* const src, const bool uppercase) noexcept
+        {
+            const __m128i mask   = _mm_set1_epi8(0x0F);
+            const __m128i nine   = _mm_set1_epi8(9);
+            const __m128i zero   = _mm_set1_epi8('0');
+            const __m128i letter = _mm_set1_epi8(uppercase ? ('A' - '0' - 10) : ('a' - '0' - 10));
+
+            __m128i bytes;
+            std::memcpy(&bytes, src, sizeof(bytes));
+
+            const __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+            const __m128i lo = _mm_and_si128(bytes, mask);
+
+            __m128i first  = _mm_unpacklo_epi8(hi, lo);
+            __m128i second = _mm_unpackhi_epi8(hi, lo);
+
+            first  = _mm_add_epi8(_mm_add_epi8(first, zero),
+                                  _mm_and_si128(_mm_cmpgt_epi8(first, nine), letter));
+            second = _mm_add_epi8(_mm_add_epi8(second, zero),
+                                  _mm_and_si128(_mm_cmpgt_epi8(second, nine), letter));
+
+            std::memcpy(dst, &first, sizeof(first));
+            std::memcpy(dst + 16, &second, sizeof(second));
+        }
+#elif defined(USF_SWAR64)
+        // 4 bytes to 8 hexadecimal characters.
+        static inline void convert_hex4(CharType* const dst, const uint8_t* const src, const bool uppercase) noexcept
+        {
+            uint32_t bytes;
+            std::memcpy(&bytes, src, sizeof(bytes));
+
+            // Spread each byte into two nibbles, high nibble first (little endian)
+            uint64_t x = bytes;
+            x = (x | (x << 16U)) & 0x0000FFFF0000FFFFULL;
+            x = (x | (x <<  8U)) & 0x00FF00FF00FF00FFULL;
+            x = ((x >> 4U) & 0x000F000F000F000FULL) | ((x & 0x000F000F000F000FULL) << 8U);
+
+            const uint64_t letters = ((x + 0x0606060606060606ULL) >> 4U) & 0x0101010101010101ULL;
+            x += 0x3030303030303030ULL + letters * (uppercase ? 7U : 39U);
+
+            std::memcpy(dst, &x, sizeof(x));
+        }
+#endif
+
+        std::ptrdiff_t hex_size(const std::ptrdiff_t size, const StringView& separator) noexcept
+        {
+            if(size <= 0) {
+                return 0;
+            }
+            return size * 2 + (size - 1) * separator.size();
+        }
+
+        void convert_hex(CharType* dst, const uint8_t* src, std::ptrdiff_t size,
+                         const StringView& separator, const bool uppercase) noexcept
+        {
+            const char* const lut = uppercase ? hex_upper_lut : hex_lower_lut;
+
+            if(!separator.empty())
+            {
+                for(std::ptrdiff_t n = 0; n < size; ++n)
+                {
+                    if(n != 0) {
+                        CharTraits::copy(dst, separator.data(), separator.size());
+                    }
+                    write_hex_byte(dst, src[n], lut);
+                }
+                return;
+            }
+
+#if defined(USF_SIMD_SSE2)
+            for(; size >= 16; size -= 16, src += 16, dst += 32) {
+                convert_hex16(dst, src, uppercase);
+            }
+#elif defined(USF_SWAR64)
+            for(; size >= 4; size -= 4, src += 4, dst += 8) {
+                convert_hex4(dst, src, uppercase);
+            }
+#endif
+            while(size-- > 0) {
+                write_hex_byte(dst, *src++, lut);
+            }
+        }
+
+        // -------- HEX DUMP --------------------------------------------------
+
+        static constexpr std::ptrdiff_t kDumpLineBytes = 16;
+
+        // Hexadecimal columns including the surrounding and middle spaces
+        static constexpr std::ptrdiff_t kDumpHexColumns = 2 + 3 * kDumpLineBytes + 2;
+
+        // Offset digits: at least 8, more when the buffer offsets need them
+        static inline int dump_offset_digits(const std::ptrdiff_t size) noexcept
+        {
+            const auto last = static_cast<uint64_t>(size - 1);
+            const int digits = Integer::count_digits_hex(last);
+            return (digits > 8) ? digits : 8;
+        }
+
+        // "OOOOOOOO  xx xx xx xx xx xx xx xx  xx xx xx xx xx xx xx xx  |................|"
+        static inline std::ptrdiff_t dump_line_size(const int offset_digits, const std::ptrdiff_t bytes) noexcept
+        {
+            return offset_digits + kDumpHexColumns + 1 + bytes + 1;
+        }
+
+        std::ptrdiff_t hexdump_size(const std::ptrdiff_t size) noexcept
+        {
+            if(size <= 0) {
+                return 0;
+            }
+
+            const int offset_digits = dump_offset_digits(size);
+            const std::ptrdiff_t lines = (size + kDumpLineBytes - 1) / kDumpLineBytes;
+            const std::ptrdiff_t last  = size - (lines - 1) * kDumpLineBytes;
+
+            // Lines are separated by a new line character (no trailing one)
+            return (lines - 1) * (dump_line_size(offset_digits, kDumpLineBytes) + 1)
+                 + dump_line_size(offset_digits, last);
+        }
+
+        void convert_hexdump(CharType* dst, const uint8_t* src, const std::ptrdiff_t size,
+                             const bool uppercase) noexcept
+        {
+            if(size <= 0) {
+                return;
+            }
+
+            const char* const lut = uppercase ? hex_upper_lut : hex_lower_lut;
+            const int offset_digits = dump_offset_digits(size);
+
+            for(std::ptrdiff_t offset = 0; offset < size; offset += kDumpLineBytes)
+            {
+                if(offset != 0) {
+                    *dst++ = '\n';
+                }
+
+                dst += offset_digits;
+                Integer::convert_hex(dst, static_cast<uint64_t>(offset), uppercase, offset_digits);
+
+                const std::ptrdiff_t bytes = std::min(size - offset, kDumpLineBytes);
+
+                // Hexadecimal columns (padded with spaces on the last line)
+                CharType* hex = dst;
+                CharTraits::assign(hex, ' ', kDumpHexColumns);
+                for(std::ptrdiff_t n = 0; n < bytes; ++n)
+                {
+                    hex = dst + 2 + 3 * n + ((n >= kDumpLineBytes / 2) ? 1 : 0);
+                    write_hex_byte(hex, src[offset + n], lut);
+                }
+                dst += kDumpHexColumns;
+
+                // ASCII column
+                *dst++ = '|';
+                for(std::ptrdiff_t n = 0; n < bytes; ++n)
+                {
+                    const uint8_t c = src[offset + n];
+                    *dst++ = (c >= 0x20U && c <= 0x7EU) ? static_cast<CharType>(c) : '.';
+                }
+                *dst++ = '|';
+            }
+        }
+
+        // -------- BASE64 ----------------------------------------------------
+
+        static constexpr char base64_lut[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#if defined(USF_SIMD_SSSE3)
+        // 12 bytes to 16 characters (W. Mula / D. Lemire). Needs 16 readable
+        // source bytes.
+        static inline void convert_base64_12(CharType* const dst, const uint8_t* const src) noexcept
+        {
+            __m128i in;
+            std::memcpy(&in, src, sizeof(in));
+
+            // Split each group of 3 bytes into 4 sextets (one per byte)
+            in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+            const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+            const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+            const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+            const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+            const __m128i indices = _mm_or_si128(t1, t3);
+
+            // Map the sextets to ASCII: select the offset of each alphabet range
+            const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                  '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                  '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+            __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices),
+                                                      _mm_set1_epi8(13)));
+
+            const __m128i chars = _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+            std::memcpy(dst, &chars, sizeof(chars));
+        }
+#elif defined(USF_SWAR64)
+        // 6 bytes to 8 characters.
+        static inline void convert_base64_6(CharType* const dst, const uint8_t* const src) noexcept
+        {
+            const uint64_t bits = (uint64_t{src[0]} << 40U) | (uint64_t{src[1]} << 32U)
+                                | (uint64_t{src[2]} << 24U) | (uint64_t{src[3]} << 16U)
+                                | (uint64_t{src[4]} <<  8U) |  uint64_t{src[5]};
+
+            // One sextet per byte, first character in the lowest byte
+            uint64_t x = 0;
+            for(unsigned n = 0; n < 8U; ++n) {
+                x |= ((bits >> (42U - 6U * n)) & 0x3FU) << (8U * n);
+            }
+
+            // Per byte "x >= k" flags (x < 64, no carry between bytes)
+            constexpr uint64_t kOnes = 0x0101010101010101ULL;
+            const uint64_t ge26 = ((x + kOnes * (128U - 26U)) >> 7U) & kOnes;
+            const uint64_t ge52 = ((x + kOnes * (128U - 52U)) >> 7U) & kOnes;
+            const uint64_t ge62 = ((x + kOnes * (128U - 62U)) >> 7U) & kOnes;
+            const uint64_t ge63 = ((x + kOnes * (128U - 63U)) >> 7U) & kOnes;
+
+            // 'A' + x, then cumulative range offsets. Every byte of the
+            // positive part is greater than the negative one (no borrow).
+            x += kOnes * 'A' + ge26 * 6U + ge63 * 3U;
+            x -= ge52 * 75U + ge62 * 15U;
+
+            std::memcpy(dst, &x, sizeof(x));
+        }
+#endif
+
+        std::ptrdiff_t base64_size(const std::ptrdiff_t size) noexcept
+        {
+            return (size <= 0) ? 0 : ((size + 2) / 3) * 4;
+        }
+
+        void convert_base64(CharType* dst, const uint8_t* src, std::ptrdiff_t size) noexcept
+        {
+#if defined(USF_SIMD_SSSE3)
+            for(; size >= 16; size -= 12, src += 12, dst += 16) {
+                convert_base64_12(dst, src);
+            }
+#elif defined(USF_SWAR64)
+            for(; size >= 6; size -= 6, src += 6, dst += 8) {
+                convert_base64_6(dst, src);
+            }
+#endif
+            for(; size >= 3; size -= 3, src += 3)
+            {
+                const uint32_t bits = (uint32_t{src[0]} << 16U) | (uint32_t{src[1]} << 8U) | src[2];
+                *dst++ = static_cast<CharType>(base64_lut[(bits >> 18U) & 0x3FU]);
+                *dst++ = static_cast<CharType>(base64_lut[(bits >> 12U) & 0x3FU]);
+                *dst++ = static_cast<CharType>(base64_lut[(bits >>  6U) & 0x3FU]);
+                *dst++ = static_cast<CharType>(base64_lut[bits & 0x3FU]);
+            }
+
+            if(size > 0)
+            {
+                const uint32_t bits = (uint32_t{src[0]} << 16U) | ((size > 1) ? (uint32_t{src[1]} << 8U) : 0U);
+                *dst++ = static_cast<CharType>(base64_lut[(bits >> 18U) & 0x3FU]);
+                *dst++ = static_cast<CharType>(base64_lut[(bits >> 12U) & 0x3FU]);
+                *dst++ = (size > 1) ? static_cast<CharType>(base64_lut[(bits >> 6U) & 0x3FU]) : '=';
+                *dst++ = '=';
+            }
+        }
+
+        // -------- STRING ESCAPING -------------------------------------------
+
+        // Short escape of each control character ('\0' for \u00XX)
+        static constexpr char escape_lut[32] =
+        {
+            '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', 'b',  't',  'n',  '\0', 'f',  'r',  '\0', '\0',
+            '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0'
+        };
+
+        static inline bool needs_escape(const uint8_t byte) noexcept
+        {
+            return byte < 0x20U || byte == '"' || byte == '\\' || byte == 0x7FU;
+        }
+
+        // Size of the escape sequence of a character that needs escaping
+        static inline std::ptrdiff_t escape_size(const uint8_t byte) noexcept
+        {
+            if(byte < 0x20U) {
+                return (escape_lut[byte] != '\0') ? 2 : 6;
+            }
+            return (byte == 0x7FU) ? 6 : 2;
+        }
+
+        // Number of characters at the beginning of `src` that don't need
+        // escaping, scanned 16 (SSE2) or 8 (SWAR) characters at a time.
+        static inline std::ptrdiff_t plain_size(const CharType* const src, const std::ptrdiff_t size) noexcept
+        {
+            std::ptrdiff_t n = 0;
+
+#if defined(USF_SIMD_SSE2)
+            const __m128i quote     = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i del       = _mm_set1_epi8(0x7F);
+            const __m128i control   = _mm_set1_epi8(0x1F);
+
+            for(; size - n >= 16; n += 16)
+            {
+                __m128i chars;
+                std::memcpy(&chars, src + n, sizeof(chars));
+
+                // Unsigned "chars <= 0x1F": min(chars, 0x1F) == chars
+                const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, backslash)),
+                                                     _mm_or_si128(_mm_cmpeq_epi8(chars, del),
+                                                                  _mm_cmpeq_epi8(_mm_min_epu8(chars, control), chars)));
+
+                const auto mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+                if(mask != 0U) {
+                    return n + __builtin_ctz(mask);
+                }
+            }
+#elif defined(USF_SWAR64)
+            constexpr uint64_t kOnes = 0x0101010101010101ULL;
+            constexpr uint64_t kHigh = 0x8080808080808080ULL;
+
+            for(; size - n >= 8; n += 8)
+            {
+                uint64_t x;
+                std::memcpy(&x, src + n, sizeof(x));
+
+                const uint64_t quote     = x ^ (kOnes * '"');
+                const uint64_t backslash = x ^ (kOnes * '\\');
+                const uint64_t del       = x ^ (kOnes * 0x7FU);
+
+                // Per byte "x < 0x20" and "x == c" flags. Borrows only set
+                // flags above a byte flagged already, so the lowest flag (the
+                // first character, little endian) is exact.
+                const uint64_t special = (((x - kOnes * 0x20U) & ~x)
+                                        | ((quote - kOnes) & ~quote)
+                                        | ((backslash - kOnes) & ~backslash)
+                                        | ((del - kOnes) & ~del)) & kHigh;
+
+                if(special != 0U) {
+                    return n + (__builtin_ctzll(special) >> 3);
+                }
+            }
+#endif
+            while(n < size && !needs_escape(static_cast<uint8_t>(src[n]))) {
+                ++n;
+            }
+            return n;
+        }
+
+        std::ptrdiff_t escaped_size(const CharType* src, std::ptrdiff_t size) noexcept
+        {
+            std::ptrdiff_t result = 0;
+
+            while(size > 0)
+            {
+                const std::ptrdiff_t plain = plain_size(src, size);
+                result += plain;
+                src    += plain;
+                size   -= plain;
+
+                if(size > 0)
+                {
+                    result += escape_size(static_cast<uint8_t>(*src++));
+                    --size;
+                }
+            }
+            return result;
+        }
+
+        void convert_escaped(CharType* dst, const CharType* src, std::ptrdiff_t size) noexcept
+        {
+            while(size > 0)
+            {
+                // Runs that need no escaping are copied as a whole
+                const std::ptrdiff_t plain = plain_size(src, size);
+                std::memcpy(dst, src, static_cast<std::size_t>(plain));
+                dst  += plain;
+                src  += plain;
+                size -= plain;
+
+                if(size > 0)
+                {
+                    const auto byte = static_cast<uint8_t>(*src++);
+                    --size;
+
+                    *dst++ = '\\';
+
+                    if(byte >= 0x20U && byte != 0x7FU) {
+                        *dst++ = static_cast<CharType>(byte);
+                    }
+                    else if(byte < 0x20U && escape_lut[byte] != '\0') {
+                        *dst++ = escape_lut[byte];
+                    }
+                    else
+                    {
+                        *dst++ = 'u';
+                        *dst++ = '0';
+                        *dst++ = '0';
+                        write_hex_byte(dst, byte, hex_lower_lut);
+                    }
+                }
+            }
+        }
+}
@@ -31,8 +31,16 @@ namespace usf {
             return "USF invalid sign (error::inv_sign)";
         case error::inv_format:
             return "USF invalid format (error::inv_format)";
+        case error::arg_name:
+            return "USF unknown argument name (error::arg_name)";
         case error::value_overflow:
             return "USF value overflow (error::value_overflow)";
+        case error::io_error:
+            return "USF input/output error (error::io_error)";
+        case error::backpressure:
+            return "USF output sink full, record dropped (error::backpressure)";
+        case error::no_match:
+            return "USF input doesn't match the format string (error::no_match)";
         }
         return "USF unknown error";
     }
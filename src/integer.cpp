@@ -1,4 +1,8 @@
 #include <usf/usf.hpp>
+#include <cstring>
+#if defined(USF_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
 
 namespace usf::internal::Integer {
 
@@ -40,6 +44,22 @@ namespace usf::internal::Integer {
         10000000000000000000U
     };
 
+#if defined(USF_INT128_SUPPORT)
+    static constexpr std::array<uint128_t, 39> make_pow10_uint128_lut() noexcept
+    {
+        std::array<uint128_t, 39> lut{};
+        uint128_t pow10 = 1;
+        for(auto& value : lut)
+        {
+            value = pow10;
+            pow10 *= 10U;
+        }
+        return lut;
+    }
+
+    static constexpr std::array<uint128_t, 39> pow10_uint128_lut = make_pow10_uint128_lut();
+#endif
+
     static constexpr char digits_hex_uppercase[]{"0123456789ABCDEF"};
     static constexpr char digits_hex_lowercase[]{"0123456789abcdef"};
 
@@ -97,6 +117,29 @@ namespace usf::internal::Integer {
             return t - (n < pow10_uint64_lut[t]) + 1;
         }
 
+#if defined(USF_INT128_SUPPORT)
+        int count_digits_dec(const uint128_t n) noexcept
+        {
+            const auto high = static_cast<uint64_t>(n >> 64U);
+            if(high == 0)
+            {
+                return count_digits_dec(static_cast<uint64_t>(n));
+            }
+
+            const int t = (128 - __builtin_clzll(high)) * 1233 >> 12;
+            return t - (n < pow10_uint128_lut[static_cast<std::size_t>(t)]) + 1;
+        }
+#endif
+
+        std::ptrdiff_t count_digits_dec(const uint32_t* values, std::ptrdiff_t count) noexcept
+        {
+            std::ptrdiff_t digits = 0;
+
+            while(count-- > 0) { digits += count_digits_dec(*values++); }
+
+            return digits;
+        }
+
         int count_digits_bin(const uint32_t n) noexcept
         {
             // The result of __builtin_clz() is undefined if `n` is 0.
@@ -109,6 +152,15 @@ namespace usf::internal::Integer {
             return (n < 2) ? 1 : (64 - __builtin_clzll(n));
         }
 
+#if defined(USF_INT128_SUPPORT)
+        int count_digits_bin(const uint128_t n) noexcept
+        {
+            const auto high = static_cast<uint64_t>(n >> 64U);
+            return (high == 0) ? count_digits_bin(static_cast<uint64_t>(n))
+                               : (128 - __builtin_clzll(high));
+        }
+#endif
+
 
         // -------- FAST DIVIDE BY 10 -----------------------------------------
         // Based on the code from Hacker's Delight:
@@ -186,78 +238,579 @@ namespace usf::internal::Integer {
             convert_dec(dst, static_cast<uint32_t>(value));
         }
 
-        // -------- BINARY CONVERSION -----------------------------------------
-        void convert_bin(CharType* dst, uint32_t value) noexcept
+        // -------- GROUPED DECIMAL CONVERSION --------------------------------
+        static constexpr char digits_dec_pairs[]
         {
-            do
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899"
+        };
+
+        // Writes the 3 digits of `group` (< 1000) preceded by `separator`.
+        static inline void write_group(CharType*& dst, const uint32_t group, const CharType separator) noexcept
+        {
+            // (group * 41) >> 12 == group / 100 for group < 1000
+            const uint32_t hundreds = (group * 41U) >> 12U;
+            const char* const pair = digits_dec_pairs + 2 * (group - hundreds * 100U);
+
+            *(--dst) = static_cast<CharType>(pair[1]);
+            *(--dst) = static_cast<CharType>(pair[0]);
+            *(--dst) = static_cast<CharType>('0' + hundreds);
+            *(--dst) = separator;
+        }
+
+        void convert_dec(CharType* dst, uint64_t value, const CharType separator) noexcept
+        {
+            while(value >= 1000U)
             {
-                const uint32_t v = value;
-                value >>= 1U;
-                *(--dst) = static_cast<CharType>('0' + (v - (value << 1U)));
-            }while(value);
+                const uint64_t q = value / 1000U;
+                write_group(dst, static_cast<uint32_t>(value - q * 1000U), separator);
+                value = q;
+            }
+
+            convert_dec(dst, static_cast<uint32_t>(value));
         }
 
-        void convert_bin(CharType* dst, uint64_t value) noexcept
+        void convert_dec(CharType* dst, uint32_t value, const CharType separator) noexcept
         {
-            while(value > std::numeric_limits<uint32_t>::max())
+            convert_dec(dst, static_cast<uint64_t>(value), separator);
+        }
+
+#if defined(USF_INT128_SUPPORT)
+        // Chunks of 18 digits (6 full groups) are split off with at most
+        // two 128 bit divisions, the rest goes through the 64 bit path.
+        void convert_dec(CharType* dst, uint128_t value, const CharType separator) noexcept
+        {
+            constexpr uint64_t kChunk = 1000000000000000000U;
+
+            while(value > std::numeric_limits<uint64_t>::max())
             {
-                const uint64_t v = value;
+                const uint128_t q = value / kChunk;
+                auto            r = static_cast<uint64_t>(value - q * kChunk);
+
+                for(int n = 0; n < 6; ++n)
+                {
+                    const uint64_t rq = r / 1000U;
+                    write_group(dst, static_cast<uint32_t>(r - rq * 1000U), separator);
+                    r = rq;
+                }
+                value = q;
+            }
+
+            convert_dec(dst, static_cast<uint64_t>(value), separator);
+        }
+#endif
+
+        // -------- SMALL COPY ------------------------------------------------
+        // Copies the `count` (up to 64) last characters of a converter buffer
+        // ending at `src_end` to the output ending at `dst_end`, using fixed
+        // size (possibly overlapping) copies instead of a variable memcpy().
+        static USF_ALWAYS_INLINE void copy_digits(CharType* const dst_end, const CharType* const src_end, const int count) noexcept
+        {
+            CharType*       dst = dst_end - count;
+            const CharType* src = src_end - count;
+
+            if(count >= 8)
+            {
+                while(src < src_end - 8)
+                {
+                    std::memcpy(dst, src, 8);
+                    dst += 8;
+                    src += 8;
+                }
+                std::memcpy(dst_end - 8, src_end - 8, 8);
+            }
+            else if(count >= 4)
+            {
+                std::memcpy(dst, src, 4);
+                std::memcpy(dst_end - 4, src_end - 4, 4);
+            }
+            else if(count >= 2)
+            {
+                std::memcpy(dst, src, 2);
+                std::memcpy(dst_end - 2, src_end - 2, 2);
+            }
+            else
+            {
+                *dst = *src;
+            }
+        }
+
+        // -------- BINARY CONVERSION -----------------------------------------
+#if defined(USF_SWAR64)
+        // The 8 bits of `byte` are spread into the 8 bytes of a 64 bit word
+        // (most significant bit first) with a single multiply-and-mask.
+        static inline uint64_t convert_bin8(const uint64_t byte) noexcept
+        {
+            return (((byte * 0x8040201008040201U) >> 7U) & 0x0101010101010101U) | 0x3030303030303030U;
+        }
+
+        void convert_bin(CharType* dst, uint64_t value, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 64);
+
+            uint64_t chars[8];
+
+            for(int i = 7; i >= 8 - ((digits + 7) >> 3); --i)
+            {
+                chars[i] = convert_bin8(value & 0xFFU);
+                value >>= 8U;
+            }
+
+            copy_digits(dst, reinterpret_cast<const CharType*>(chars) + 64, digits);
+        }
+#else
+        void convert_bin(CharType* dst, uint64_t value, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 64);
+
+            for(int i = 0; i < digits; ++i)
+            {
+                *(--dst) = static_cast<CharType>('0' + (value & 1U));
                 value >>= 1U;
-                *(--dst) = static_cast<CharType>('0' + (v - (value << 1U)));
             }
+        }
+#endif
 
-            convert_bin(dst, static_cast<uint32_t>(value));
+        void convert_bin(CharType* dst, uint32_t value, const int digits) noexcept
+        {
+            convert_bin(dst, static_cast<uint64_t>(value), digits);
+        }
+
+        void convert_bin(CharType* dst, uint32_t value) noexcept
+        {
+            convert_bin(dst, static_cast<uint64_t>(value), count_digits_bin(value));
+        }
+
+        void convert_bin(CharType* dst, uint64_t value) noexcept
+        {
+            convert_bin(dst, value, count_digits_bin(value));
         }
 
         // -------- OCTAL CONVERSION ------------------------------------------
-        void convert_oct(CharType* dst, uint32_t value) noexcept
+#if defined(USF_SWAR64)
+        // The 24 lower bits of `value` are spread into 3 bit groups, one per
+        // byte of a 64 bit word (most significant group first).
+        static inline uint64_t convert_oct8(uint64_t value) noexcept
         {
-            do
+            value = (value & 0x0000000000000FFFU) | ((value & 0x0000000000FFF000U) << 20U);
+            value = (value & 0x0000003F0000003FU) | ((value & 0x00000FC000000FC0U) << 10U);
+            value = (value & 0x0007000700070007U) | ((value & 0x0038003800380038U) <<  5U);
+
+            return __builtin_bswap64(value) | 0x3030303030303030U;
+        }
+
+        void convert_oct(CharType* dst, uint64_t value, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 22);
+
+            uint64_t chars[3];
+
+            for(int i = 2; i >= 3 - ((digits + 7) >> 3); --i)
             {
-                const uint32_t v = value;
+                chars[i] = convert_oct8(value & 0xFFFFFFU);
+                value >>= 24U;
+            }
+
+            copy_digits(dst, reinterpret_cast<const CharType*>(chars) + 24, digits);
+        }
+#else
+        void convert_oct(CharType* dst, uint64_t value, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 22);
+
+            for(int i = 0; i < digits; ++i)
+            {
+                *(--dst) = static_cast<CharType>('0' + (value & 7U));
                 value >>= 3U;
-                *(--dst) = static_cast<CharType>('0' + (v - (value << 3U)));
-            }while(value);
+            }
+        }
+#endif
+
+        void convert_oct(CharType* dst, uint32_t value, const int digits) noexcept
+        {
+            convert_oct(dst, static_cast<uint64_t>(value), digits);
+        }
+
+        void convert_oct(CharType* dst, uint32_t value) noexcept
+        {
+            convert_oct(dst, static_cast<uint64_t>(value), count_digits_oct(value));
         }
 
         void convert_oct(CharType* dst, uint64_t value) noexcept
         {
-            while(value > std::numeric_limits<uint32_t>::max())
+            convert_oct(dst, value, count_digits_oct(value));
+        }
+
+        // -------- HEXADECIMAL CONVERSION ------------------------------------
+#if defined(USF_SWAR64)
+        // All the nibbles of a 32 bit value are expanded at once into the 8
+        // bytes of a 64 bit register (most significant nibble in the first
+        // byte) and converted to ASCII without any per digit branch.
+        static inline uint64_t convert_hex8(const uint32_t value, const bool uppercase) noexcept
+        {
+            uint64_t x = value;
+
+            x = (x | (x << 16U)) & 0x0000FFFF0000FFFFU;
+            x = (x | (x <<  8U)) & 0x00FF00FF00FF00FFU;
+            x = (x | (x <<  4U)) & 0x0F0F0F0F0F0F0F0FU;
+
+            x = __builtin_bswap64(x);
+
+            // 0x01 in every byte with a nibble greater than 9
+            const uint64_t letters = ((x + 0x0606060606060606U) >> 4U) & 0x0101010101010101U;
+
+            return x + 0x3030303030303030U + letters * (uppercase ? 7U : 39U);
+        }
+
+        void convert_hex(CharType* dst, uint64_t value, const bool uppercase, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 16);
+
+            const uint64_t chars[2]{convert_hex8(static_cast<uint32_t>(value >> 32U), uppercase),
+                                    convert_hex8(static_cast<uint32_t>(value), uppercase)};
+
+            copy_digits(dst, reinterpret_cast<const CharType*>(chars) + 16, digits);
+        }
+
+        void convert_hex(CharType* dst, uint32_t value, const bool uppercase, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 16);
+
+            if(digits > 8)
             {
-                const uint64_t v = value;
-                value >>= 3U;
-                *(--dst) = static_cast<CharType>('0' + (v - (value << 3U)));
+                convert_hex(dst, static_cast<uint64_t>(value), uppercase, digits);
+                return;
             }
 
-            convert_oct(dst, static_cast<uint32_t>(value));
+            const uint64_t chars = convert_hex8(value, uppercase);
+
+            copy_digits(dst, reinterpret_cast<const CharType*>(&chars) + 8, digits);
         }
+#else
+        void convert_hex(CharType* dst, uint32_t value, const bool uppercase, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 16);
 
-        // -------- HEXADECIMAL CONVERSION ------------------------------------
-        void convert_hex(CharType* dst, uint32_t value, const bool uppercase) noexcept
+            const char* hex_digits = uppercase ? digits_hex_uppercase : digits_hex_lowercase;
+
+            for(int i = 0; i < digits; ++i)
+            {
+                *(--dst) = static_cast<CharType>(hex_digits[value & 0xFU]);
+                value >>= 4U;
+            }
+        }
+
+        void convert_hex(CharType* dst, uint64_t value, const bool uppercase, const int digits) noexcept
         {
-            const char* digits = uppercase ? digits_hex_uppercase : digits_hex_lowercase;
+            assert(digits > 0 && digits <= 16);
 
-            do
+            const char* hex_digits = uppercase ? digits_hex_uppercase : digits_hex_lowercase;
+
+            for(int i = 0; i < digits; ++i)
             {
-                const uint32_t v = value;
+                *(--dst) = static_cast<CharType>(hex_digits[value & 0xFU]);
                 value >>= 4U;
-                *(--dst) = static_cast<CharType>(digits[v - (value << 4U)]);
-            }while(value);
+            }
+        }
+#endif
 
+        void convert_hex(CharType* dst, uint32_t value, const bool uppercase) noexcept
+        {
+            convert_hex(dst, value, uppercase, count_digits_hex(value));
         }
 
         void convert_hex(CharType* dst, uint64_t value, const bool uppercase) noexcept
         {
-            const char* digits = uppercase ? digits_hex_uppercase : digits_hex_lowercase;
+            convert_hex(dst, value, uppercase, count_digits_hex(value));
+        }
 
-            while(value > std::numeric_limits<uint32_t>::max())
+        // -------- 128 BIT CONVERSION ----------------------------------------
+#if defined(USF_INT128_SUPPORT)
+        // Chunks of 19 decimal digits (10^19 < 2^64) are split off with at
+        // most two 128 bit divisions, the rest goes through the 64 bit path.
+        void convert_dec(CharType* dst, uint128_t value) noexcept
+        {
+            constexpr uint64_t kChunk = 10000000000000000000U;
+
+            while(value > std::numeric_limits<uint64_t>::max())
             {
-                const uint64_t v = value;
-                value >>= 4U;
-                *(--dst) = static_cast<CharType>(digits[v - (value << 4U)]);
+                const uint128_t q = value / kChunk;
+                const auto      r = static_cast<uint64_t>(value - q * kChunk);
+
+                CharType* it = dst - 19;
+                CharTraits::assign(it, '0', 19);
+                convert_dec(dst, r);
+
+                dst  -= 19;
+                value = q;
+            }
+
+            convert_dec(dst, static_cast<uint64_t>(value));
+        }
+
+        void convert_bin(CharType* dst, uint128_t value, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 128);
+
+            if(digits > 64)
+            {
+                convert_bin(dst, static_cast<uint64_t>(value), 64);
+                dst   -= 64;
+                value >>= 64U;
+            }
+            convert_bin(dst, static_cast<uint64_t>(value), (digits > 64) ? digits - 64 : digits);
+        }
+
+        // 21 octal digits (63 bits) per 64 bit chunk
+        void convert_oct(CharType* dst, uint128_t value, int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 43);
+
+            while(digits > 21)
+            {
+                convert_oct(dst, static_cast<uint64_t>(value) & 0x7FFFFFFFFFFFFFFFU, 21);
+                dst    -= 21;
+                digits -= 21;
+                value >>= 63U;
+            }
+            convert_oct(dst, static_cast<uint64_t>(value), digits);
+        }
+
+        void convert_hex(CharType* dst, uint128_t value, const bool uppercase, const int digits) noexcept
+        {
+            assert(digits > 0 && digits <= 32);
+
+            if(digits > 16)
+            {
+                convert_hex(dst, static_cast<uint64_t>(value), uppercase, 16);
+                dst   -= 16;
+                value >>= 64U;
+            }
+            convert_hex(dst, static_cast<uint64_t>(value), uppercase, (digits > 16) ? digits - 16 : digits);
+        }
+#endif // defined(USF_INT128_SUPPORT)
+
+        // -------- DECIMAL ARRAY CONVERSION ----------------------------------
+        // The lower 8 digits of two values are converted at once (16 ASCII
+        // characters) using multiply-shift divisions by 10^4, 10^2 and 10
+        // instead of the 8 dependent div10() steps per value. The upper
+        // digits (1 or 2, since 2^32 < 10^10) are written separately.
+        // --------------------------------------------------------------------
+
+        static constexpr uint32_t kDec8Limit = 100000000U;
+
+#if defined(USF_SIMD_SSE2)
+        // Both `a` and `b` must be lower than 10^8.
+        static inline void convert_dec8x2(CharType* const dst, const uint32_t a, const uint32_t b) noexcept
+        {
+            const __m128i v = _mm_set_epi32(0, static_cast<int>(b), 0, static_cast<int>(a));
+
+            // 64 bit lanes: [a / 10^4, b / 10^4] and [a % 10^4, b % 10^4]
+            const __m128i hi = _mm_srli_epi64(_mm_mul_epu32(v, _mm_set1_epi32(static_cast<int>(0xD1B71759U))), 45);
+            const __m128i lo = _mm_sub_epi32(v, _mm_mul_epu32(hi, _mm_set1_epi32(10000)));
+
+            // 32 bit lanes: [a / 10^4, a % 10^4, b / 10^4, b % 10^4]
+            const __m128i x = _mm_or_si128(hi, _mm_slli_epi64(lo, 32));
+
+            // 16 bit lanes: pairs of digits [0, 99]
+            const __m128i q = _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16(5243)), 3);
+            const __m128i r = _mm_sub_epi16(x, _mm_mullo_epi16(q, _mm_set1_epi16(100)));
+            const __m128i y = _mm_or_si128(q, _mm_slli_epi32(r, 16));
+
+            // 8 bit lanes: single digits
+            const __m128i t = _mm_mulhi_epu16(y, _mm_set1_epi16(6554));
+            const __m128i u = _mm_sub_epi16(y, _mm_mullo_epi16(t, _mm_set1_epi16(10)));
+            const __m128i d = _mm_add_epi8(_mm_or_si128(t, _mm_slli_epi16(u, 8)), _mm_set1_epi8('0'));
+
+            std::memcpy(dst, &d, 16);
+        }
+#elif defined(USF_SWAR64)
+        // Same algorithm as above using the lanes of a 64 bit register.
+        static inline uint64_t convert_dec8(const uint32_t value) noexcept
+        {
+            const uint64_t hi = value / 10000U;
+            const uint64_t x  = hi | ((value - hi * 10000U) << 32U);
+
+            const uint64_t q = ((x * 5243U) >> 19U) & 0x0000007F0000007FU;
+            const uint64_t y = q | ((x - q * 100U) << 16U);
+
+            const uint64_t t = ((y * 103U) >> 10U) & 0x000F000F000F000FU;
+
+            return (t | ((y - t * 10U) << 8U)) | 0x3030303030303030U;
+        }
+
+        static inline void convert_dec8x2(CharType* const dst, const uint32_t a, const uint32_t b) noexcept
+        {
+            const uint64_t d[2]{convert_dec8(a), convert_dec8(b)};
+
+            std::memcpy(dst, d, 16);
+        }
+#else
+        static inline void convert_dec8x2(CharType* const dst, uint32_t a, uint32_t b) noexcept
+        {
+            for(int i = 7; i >= 0; --i)
+            {
+                const uint32_t va = a;
+                const uint32_t vb = b;
+                a = div10(a);
+                b = div10(b);
+                dst[i]     = static_cast<CharType>('0' + (va - (a * 10)));
+                dst[i + 8] = static_cast<CharType>('0' + (vb - (b * 10)));
+            }
+        }
+#endif
+
+        // Writes `value` back to front, `low_digits` holds its lower 8 digits (zero padded).
+        static inline void write_dec_joined(CharType*& dst, const uint32_t value, const CharType* const low_digits) noexcept
+        {
+            if(value < kDec8Limit)
+            {
+                const int digits = count_digits_dec(value);
+                dst -= digits;
+                CharType* it = dst;
+                CharTraits::copy(it, low_digits + 8 - digits, digits);
+            }
+            else
+            {
+                dst -= 8;
+                CharType* it = dst;
+                CharTraits::copy(it, low_digits, 8);
+
+                uint32_t high = value / kDec8Limit;
+
+                if(high >= 10)
+                {
+                    const uint32_t v = high;
+                    high = div10(high);
+                    *(--dst) = static_cast<CharType>('0' + (v - (high * 10)));
+                }
+                *(--dst) = static_cast<CharType>('0' + high);
+            }
+        }
+
+        static inline void write_separator(CharType*& dst, const StringView& separator) noexcept
+        {
+            dst -= separator.size();
+            CharType* it = dst;
+            CharTraits::copy(it, separator.data(), separator.size());
+        }
+
+        void convert_dec(CharType* dst, const uint32_t* const values, std::ptrdiff_t count,
+                         const StringView& separator) noexcept
+        {
+            CharType low_digits[16]{};
+
+            // Convert from the last to the first element, two at a time.
+            while(count > 0)
+            {
+                const uint32_t b = values[--count];
+                const uint32_t a = (count > 0) ? values[count - 1] : 0;
+
+                convert_dec8x2(low_digits, a % kDec8Limit, b % kDec8Limit);
+
+                write_dec_joined(dst, b, low_digits + 8);
+
+                if(count > 0)
+                {
+                    --count;
+                    write_separator(dst, separator);
+                    write_dec_joined(dst, a, low_digits);
+                }
+
+                if(count > 0) { write_separator(dst, separator); }
+            }
+        }
+
+        // -------- PARSING ---------------------------------------------------
+        // Decimal digits are parsed 8 at a time as long as the value can't
+        // overflow: 8 characters loaded in a 64 bit word, checked and
+        // combined into pairs, quads and the 8 digit value with 3
+        // multiply-shift steps.
+        // --------------------------------------------------------------------
+
+#if defined(USF_SWAR64)
+        static inline bool is_dec8(const uint64_t chars) noexcept
+        {
+            // Each byte in ['0', '9']: high nibble 3 and no carry out of
+            // the low nibble when adding 6.
+            return (((chars & 0xF0F0F0F0F0F0F0F0U) | (((chars + 0x0606060606060606U) & 0xF0F0F0F0F0F0F0F0U) >> 4U))
+                    == 0x3333333333333333U);
+        }
+
+        static inline uint32_t parse_dec8(uint64_t chars) noexcept
+        {
+            chars = ((chars & 0x0F0F0F0F0F0F0F0FU) * 2561U) >> 8U;
+            chars = ((chars & 0x00FF00FF00FF00FFU) * 6553601U) >> 16U;
+            return static_cast<uint32_t>(((chars & 0x0000FFFF0000FFFFU) * 42949672960001U) >> 32U);
+        }
+#endif
+
+        static inline int digit_value(const CharType c) noexcept
+        {
+            if(c >= '0' && c <= '9') { return c - '0'; }
+            if(c >= 'a' && c <= 'z') { return c - 'a' + 10; }
+            if(c >= 'A' && c <= 'Z') { return c - 'A' + 10; }
+            return 36;
+        }
+
+        error parse_dec(const CharType*& it, const CharType* const end, uint64_t& value) noexcept
+        {
+            value = 0;
+
+#if defined(USF_SWAR64)
+            // value * 10^8 + 99999999 fits while value < 10^11
+            const uint64_t limit = pow10_uint64(11);
+            const uint64_t scale = pow10_uint64(8);
+
+            while(end - it >= 8 && value < limit)
+            {
+                uint64_t chars;
+                std::memcpy(&chars, it, 8);
+
+                if(!is_dec8(chars)) { break; }
+
+                value = value * scale + parse_dec8(chars);
+                it += 8;
+            }
+#endif
+
+            bool overflow = false;
+
+            for(; it < end && *it >= '0' && *it <= '9'; ++it)
+            {
+                overflow = overflow || __builtin_mul_overflow(value, 10U, &value)
+                                    || __builtin_add_overflow(value, static_cast<uint64_t>(*it - '0'), &value);
+            }
+
+            //USF_ENFORCE(!overflow, std::runtime_error);
+            return overflow ? error::value_overflow : error::success;
+        }
+
+        error parse_pow2(const CharType*& it, const CharType* const end, uint64_t& value, const int bits) noexcept
+        {
+            assert(bits == 1 || bits == 3 || bits == 4);
+
+            const int base = 1 << bits;
+            bool overflow = false;
+
+            value = 0;
+
+            for(int digit = 0; it < end && (digit = digit_value(*it)) < base; ++it)
+            {
+                overflow = overflow || (value >> (64 - bits)) != 0;
+                value = (value << bits) | static_cast<uint64_t>(digit);
             }
 
-            convert_hex(dst, static_cast<uint32_t>(value), uppercase);
+            //USF_ENFORCE(!overflow, std::runtime_error);
+            return overflow ? error::value_overflow : error::success;
         }
 
 }
@@ -0,0 +1,376 @@
+#include <usf/usf.hpp>
+#include <cmath>
+
+namespace usf {
+
+CharType* JsonWriter::reserve(const std::ptrdiff_t size) noexcept
+{
+    //USF_ENFORCE(size <= m_end - m_it, std::runtime_error);
+    if(size > m_end - m_it)
+    {
+        set_error(error::buf_overflow);
+        return nullptr;
+    }
+
+    CharType* const it = m_it;
+    m_it += size;
+    return it;
+}
+
+bool JsonWriter::begin_value() noexcept
+{
+    if(m_error != error::success) {
+        return false;
+    }
+
+    if(m_depth == 0)
+    {
+        // A single value at the top level
+        //USF_ENFORCE(m_first, std::runtime_error);
+        if(!m_first)
+        {
+            set_error(error::inv_format);
+            return false;
+        }
+    }
+    else if(in_object())
+    {
+        // The separator is written by key()
+        //USF_ENFORCE(m_after_key, std::runtime_error);
+        if(!m_after_key)
+        {
+            set_error(error::inv_format);
+            return false;
+        }
+        m_after_key = false;
+    }
+    else if(!m_first)
+    {
+        CharType* const it = reserve(1);
+        if(it == nullptr) {
+            return false;
+        }
+        *it = ',';
+    }
+
+    m_first = false;
+    return true;
+}
+
+JsonWriter& JsonWriter::begin_container(const bool object) noexcept
+{
+    if(!begin_value()) {
+        return *this;
+    }
+
+    //USF_ENFORCE(m_depth < kMaxDepth, std::runtime_error);
+    if(m_depth >= kMaxDepth)
+    {
+        set_error(error::buf_overflow);
+        return *this;
+    }
+
+    CharType* const it = reserve(1);
+    if(it == nullptr) {
+        return *this;
+    }
+    *it = object ? '{' : '[';
+
+    const uint32_t bit = 1U << m_depth;
+    m_stack = object ? (m_stack | bit) : (m_stack & ~bit);
+    ++m_depth;
+    m_first = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::end_container(const bool object) noexcept
+{
+    if(m_error != error::success) {
+        return *this;
+    }
+
+    //USF_ENFORCE(m_depth > 0 && in_object() == object && !m_after_key, std::runtime_error);
+    if(m_depth == 0 || in_object() != object || m_after_key)
+    {
+        set_error(error::inv_format);
+        return *this;
+    }
+
+    CharType* const it = reserve(1);
+    if(it == nullptr) {
+        return *this;
+    }
+    *it = object ? '}' : ']';
+
+    --m_depth;
+    m_first = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(const StringView name) noexcept
+{
+    if(m_error != error::success) {
+        return *this;
+    }
+
+    //USF_ENFORCE(m_depth > 0 && in_object() && !m_after_key, std::runtime_error);
+    if(m_depth == 0 || !in_object() || m_after_key)
+    {
+        set_error(error::inv_format);
+        return *this;
+    }
+
+    const std::ptrdiff_t size = internal::Encoding::escaped_size(name.data(), name.size());
+    const std::ptrdiff_t separator = m_first ? 0 : 1;
+
+    CharType* it = reserve(separator + size + 3);
+    if(it == nullptr) {
+        return *this;
+    }
+
+    if(separator != 0) { *it++ = ','; }
+    *it++ = '"';
+    internal::Encoding::convert_escaped(it, name.data(), name.size());
+    it += size;
+    *it++ = '"';
+    *it   = ':';
+
+    m_first = false;
+    m_after_key = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(std::nullptr_t) noexcept
+{
+    return raw(StringView("null", 4));
+}
+
+JsonWriter& JsonWriter::value(const bool value) noexcept
+{
+    return raw(value ? StringView("true", 4) : StringView("false", 5));
+}
+
+JsonWriter& JsonWriter::value(const StringView value) noexcept
+{
+    if(!begin_value()) {
+        return *this;
+    }
+
+    const std::ptrdiff_t size = internal::Encoding::escaped_size(value.data(), value.size());
+
+    CharType* it = reserve(size + 2);
+    if(it == nullptr) {
+        return *this;
+    }
+
+    *it++ = '"';
+    internal::Encoding::convert_escaped(it, value.data(), value.size());
+    it += size;
+    *it = '"';
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(const StringView json) noexcept
+{
+    if(!begin_value()) {
+        return *this;
+    }
+
+    CharType* it = reserve(json.size());
+    if(it != nullptr) {
+        internal::CharTraits::copy(it, json.data(), json.size());
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::write_integer(const uint32_t value, const bool negative) noexcept
+{
+    if(!begin_value()) {
+        return *this;
+    }
+
+    const int digits = internal::Integer::count_digits_dec(value);
+
+    CharType* it = reserve(digits + static_cast<int>(negative));
+    if(it == nullptr) {
+        return *this;
+    }
+
+    if(negative) { *it++ = '-'; }
+    internal::Integer::convert_dec(it + digits, value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::write_integer(const uint64_t value, const bool negative) noexcept
+{
+    if(!begin_value()) {
+        return *this;
+    }
+
+    const int digits = internal::Integer::count_digits_dec(value);
+
+    CharType* it = reserve(digits + static_cast<int>(negative));
+    if(it == nullptr) {
+        return *this;
+    }
+
+    if(negative) { *it++ = '-'; }
+    internal::Integer::convert_dec(it + digits, value);
+    return *this;
+}
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+JsonWriter& JsonWriter::value(double value, const int precision) noexcept
+{
+    if(m_error != error::success) {
+        return *this;
+    }
+
+    //USF_ENFORCE(precision >= 1 && precision <= 15, std::runtime_error);
+    if(precision < 1 || precision > 15)
+    {
+        set_error(error::arg_precision);
+        return *this;
+    }
+
+    const bool negative = std::signbit(value);
+    if(negative) { value = -value; }
+
+    if(std::fpclassify(value) == FP_ZERO) {
+        return raw(negative ? StringView("-0", 2) : StringView("0", 1));
+    }
+
+    // NaN and infinities
+    if(!std::isfinite(value)) {
+        return raw(StringView("null", 4));
+    }
+
+    // Out of the converter range ([1e-19, 1.8e19]): scaled into [1, 10) by a
+    // power of ten (one more rounding error), the exponent shifted back
+    // after the conversion.
+    int shift = 0;
+
+    if(!(value >= 1E-19 && value <= 1.8446744E19))
+    {
+        shift = static_cast<int>(std::floor(std::log10(value)));
+
+        // 10^-shift overflows for the smallest (subnormal) values
+        value = (shift > 0) ? value / std::pow(10.0, shift)
+                            : value * 1E300 * std::pow(10.0, -shift - 300);
+    }
+
+    if(!begin_value()) {
+        return *this;
+    }
+
+    // General format, trailing zeros removed (see Argument::format_float())
+    CharType significand[36]{};
+    int exponent = 0;
+
+    const int size = internal::Float::convert(significand, exponent, value, false, precision - 1);
+    const int sign = static_cast<int>(negative);
+
+    exponent += shift;
+
+    CharType* it = nullptr;
+
+    if(exponent < -4 || exponent >= precision)
+    {
+        // SIGNIFICAND[0]<.SIGNIFICAND[1:N]>e[+-]EXP, at least two digits
+        // exponent (three beyond the converter range, up to e+308 / e-324)
+        const int exponent_abs = (exponent < 0) ? -exponent : exponent;
+        const int exponent_digits = (exponent_abs < 100) ? 2 : 3;
+
+        it = reserve(sign + size + static_cast<int>(size > 1) + 2 + exponent_digits);
+        if(it == nullptr) {
+            return *this;
+        }
+        if(negative) { *it++ = '-'; }
+
+        *it++ = significand[0];
+        if(size > 1)
+        {
+            *it++ = '.';
+            internal::CharTraits::copy(it, significand + 1, size - 1);
+        }
+
+        *it++ = 'e';
+        *it++ = (exponent < 0) ? '-' : '+';
+        if(exponent_digits == 3) { *it++ = static_cast<CharType>('0' + exponent_abs / 100); }
+        *it++ = static_cast<CharType>('0' + exponent_abs / 10 % 10);
+        *it   = static_cast<CharType>('0' + exponent_abs % 10);
+    }
+    else if(exponent < 0)
+    {
+        // 0.<0>SIGNIFICAND
+        const int zero_digits = -exponent - 1;
+
+        it = reserve(sign + 2 + zero_digits + size);
+        if(it == nullptr) {
+            return *this;
+        }
+        if(negative) { *it++ = '-'; }
+
+        *it++ = '0';
+        *it++ = '.';
+        internal::CharTraits::assign(it, '0', zero_digits);
+        internal::CharTraits::copy(it, significand, size);
+    }
+    else
+    {
+        const int ipart_digits = exponent + 1;
+
+        if(ipart_digits >= size)
+        {
+            // SIGNIFICAND<0>
+            it = reserve(sign + ipart_digits);
+            if(it == nullptr) {
+                return *this;
+            }
+            if(negative) { *it++ = '-'; }
+
+            internal::CharTraits::copy(it, significand, size);
+            internal::CharTraits::assign(it, '0', ipart_digits - size);
+        }
+        else
+        {
+            // SIGNIFICAND[0:x].SIGNIFICAND[x:N]
+            it = reserve(sign + size + 1);
+            if(it == nullptr) {
+                return *this;
+            }
+            if(negative) { *it++ = '-'; }
+
+            internal::CharTraits::copy(it, significand, ipart_digits);
+            *it++ = '.';
+            internal::CharTraits::copy(it, significand + ipart_digits, size - ipart_digits);
+        }
+    }
+    return *this;
+}
+#endif
+
+result_t JsonWriter::finish() noexcept
+{
+    if(m_error != error::success) {
+        return {m_error, {}};
+    }
+
+    //USF_ENFORCE(m_depth == 0 && !m_first, std::runtime_error);
+    if(m_depth != 0 || m_first) {
+        return {error::inv_format, {}};
+    }
+
+#if !defined(USF_DISABLE_STRING_TERMINATION)
+    // If not disabled in configuration, null terminate the resulting string.
+    //USF_ENFORCE(m_it < m_end, std::runtime_error);
+    if(m_it == m_end) {
+        return {error::buf_overflow, {}};
+    }
+    *m_it = CharType{};
+#endif
+
+    return {error::success, StringSpan(m_begin, m_it)};
+}
+
+} // namespace usf
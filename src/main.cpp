@@ -1,4 +1,5 @@
 #include <usf/usf.hpp>
+#include <new>
 
 namespace usf::internal {
 
@@ -52,18 +53,41 @@ error parse_format_string(usf::StringSpan& str, usf::StringView& fmt)
 }
 
 error process(usf::StringSpan& str, usf::StringView& fmt,
-             const Argument* const args, const int arg_count)
+             const Argument* const args, const int arg_count, const usf::StringView* const names)
 {
     // Argument's sequential index
     int arg_seq_index = 0;
 
+    // Output of the positional fields, copied by the later fields of the same
+    // argument and format spec ("{0} ... {0}") instead of converting again.
+    struct Rendered
+    {
+        const CharType* data;
+        std::ptrdiff_t  size;
+        ArgFormat       format;
+    };
+
+    // Left uninitialized, the entries are constructed when added: the
+    // sequential fields don't pay for the cache.
+    union RenderedSlot
+    {
+        RenderedSlot() noexcept {}
+
+        Rendered entry;
+    };
+
+    constexpr int kMaxRendered = 8;
+
+    RenderedSlot rendered[kMaxRendered];
+    int rendered_count = 0;
+
     if(auto err=parse_format_string(str, fmt); err!=error::success) {
         return err;
     }
 
     while(!fmt.empty())
     {
-        ArgFormat format(fmt, arg_count);
+        ArgFormat format(fmt, arg_count, names, (names != nullptr) ? arg_count : 0);
 
         if(format.ec_error()!=error::success) {
             return format.ec_error();
@@ -79,10 +103,48 @@ error process(usf::StringSpan& str, usf::StringView& fmt,
                 return error::arg_index_too_large;
             }
             arg_index = arg_seq_index++;
+
+            if(auto err=args[arg_index].format(str, format); err!=error::success) {
+                return err;
+            }
         }
+        else
+        {
+            const Rendered* found = nullptr;
 
-        if(auto err=args[arg_index].format(str, format); err!=error::success) {
-            return err;
+            for(int n = 0; n < rendered_count && found == nullptr; ++n)
+            {
+                const Rendered& entry = rendered[n].entry;
+
+                if(entry.format.index() == arg_index && entry.format.same_spec(format)) {
+                    found = &entry;
+                }
+            }
+
+            if(found != nullptr)
+            {
+                //USF_ENFORCE(found->size < str.size(), std::runtime_error);
+                if(found->size >= str.size()) {
+                    return error::buf_overflow;
+                }
+
+                CharType* str_it = str.begin();
+                CharTraits::copy(str_it, found->data, found->size);
+                str.remove_prefix(found->size);
+            }
+            else
+            {
+                const CharType* const field_begin = str.begin();
+                const ArgFormat spec = format;  // format() may adjust the alignment
+
+                if(auto err=args[arg_index].format(str, format); err!=error::success) {
+                    return err;
+                }
+
+                if(rendered_count < kMaxRendered) {
+                    new (&rendered[rendered_count++].entry) Rendered{field_begin, str.begin() - field_begin, spec};
+                }
+            }
         }
 
         if(auto err=parse_format_string(str, fmt); err!=error::success) {
@@ -92,4 +154,78 @@ error process(usf::StringSpan& str, usf::StringView& fmt,
     return error::success;
 }
 
-}
\ No newline at end of file
+} // namespace usf::internal
+
+namespace usf {
+
+result_t resolve_arg_names(StringSpan str, StringView fmt, std::initializer_list<StringView> names)
+{
+    auto is_name_start = [](const CharType c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; };
+    auto is_name_char  = [&](const CharType c) { return is_name_start(c) || (c >= '0' && c <= '9'); };
+
+          CharType* str_it = str.begin();
+    const CharType* fmt_it = fmt.cbegin();
+
+    while(fmt_it < fmt.cend() && str_it < str.end())
+    {
+        if(*fmt_it == '{' && fmt_it + 1 < fmt.cend() && is_name_start(*(fmt_it + 1)))
+        {
+            *str_it++ = *fmt_it++;
+
+            const CharType* const name = fmt_it;
+            while(fmt_it < fmt.cend() && is_name_char(*fmt_it)) { ++fmt_it; }
+
+            const auto name_size = fmt_it - name;
+
+            int index = 0;
+            for(const auto& candidate : names)
+            {
+                if(candidate.size() == name_size && std::equal(name, fmt_it, candidate.cbegin())) { break; }
+                ++index;
+            }
+
+            //USF_ENFORCE(index < names.size(), std::runtime_error);
+            if(index == static_cast<int>(names.size())) {
+                return {error::arg_name, {}};
+            }
+
+            // Write the argument index (3 digits at most)
+            const int digits = (index < 10) ? 1 : (index < 100) ? 2 : 3;
+            if(str.end() - str_it <= digits) {
+                return {error::buf_overflow, {}};
+            }
+
+            for(int n = digits - 1; n >= 0; --n)
+            {
+                str_it[n] = static_cast<CharType>('0' + index % 10);
+                index /= 10;
+            }
+            str_it += digits;
+        }
+        else if((*fmt_it == '{' || *fmt_it == '}') && fmt_it + 1 < fmt.cend() && *(fmt_it + 1) == *fmt_it)
+        {
+            // Keep the '{{' and '}}' escape characters as they are.
+            *str_it++ = *fmt_it++;
+            if(str_it < str.end()) { *str_it++ = *fmt_it++; }
+        }
+        else
+        {
+            // Copy literal text and argument indices
+            *str_it++ = *fmt_it++;
+        }
+    }
+
+    //USF_ENFORCE(str_it < str.end(), std::runtime_error);
+    if(str_it >= str.end()) {
+        return {error::buf_overflow, {}};
+    }
+
+#if !defined(USF_DISABLE_STRING_TERMINATION)
+    // If not disabled in configuration, null terminate the resulting string.
+    *str_it = CharType{};
+#endif
+
+    return {error::success, StringSpan(str.begin(), str_it)};
+}
+
+} // namespace usf
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <usf/usf.hpp>
+
+#include <cstring>
+#include <thread>
+
+namespace usf {
+
+MpscSink::MpscSink(StringSpan str, const std::ptrdiff_t max_record) noexcept
+    : m_max_record(max_record)
+{
+    // Record headers are aligned on their size
+    const auto address = reinterpret_cast<std::uintptr_t>(str.begin());
+    const auto skip    = static_cast<std::ptrdiff_t>((kAlign - address % kAlign) % kAlign);
+
+    if(str.size() > skip)
+    {
+        const auto size = static_cast<std::uint64_t>(str.size() - skip);
+
+        m_capacity = 1;
+        while(m_capacity * 2 <= size) { m_capacity *= 2; }
+
+        // Headers read as not committed until written
+        m_data = str.begin() + skip;
+        std::memset(m_data, 0, m_capacity);
+    }
+
+    //USF_ENFORCE(record_size(max_record) <= m_capacity, std::runtime_error);
+    if(max_record <= 0 || m_capacity < kAlign || record_size(static_cast<std::uint64_t>(max_record)) > m_capacity)
+    {
+        m_data  = nullptr;
+        m_error = error::buf_overflow;
+    }
+}
+
+std::pair<error, MpscSink::Record> MpscSink::reserve(const std::ptrdiff_t size) noexcept
+{
+    //USF_ENFORCE(record_size(size) <= m_capacity, std::runtime_error);
+    if(m_data == nullptr || size <= 0 || record_size(static_cast<std::uint64_t>(size)) > m_capacity) {
+        return {error::buf_overflow, {StringSpan(nullptr, nullptr), 0}};
+    }
+
+    const std::uint64_t total = record_size(static_cast<std::uint64_t>(size));
+
+    for(;;)
+    {
+        const std::uint64_t position = m_reserved.fetch_add(total, std::memory_order_relaxed);
+
+        wait_space(position + total);
+
+        if((position & (m_capacity - 1)) + total <= m_capacity) {
+            return {error::success, {StringSpan(reinterpret_cast<CharType*>(header(position) + 1), size), position}};
+        }
+
+        // Records are not split at the end of the buffer: the reservation
+        // is committed empty and the record reserved again.
+        publish(position, total, 0);
+    }
+}
+
+void MpscSink::commit(const Record& record, const std::ptrdiff_t used) noexcept
+{
+    publish(record.position, record_size(static_cast<std::uint64_t>(record.span.size())), used);
+}
+
+void MpscSink::publish(const std::uint64_t position, const std::uint64_t size, const std::ptrdiff_t used) noexcept
+{
+    RecordHeader* const record = header(position);
+
+    record->size = static_cast<std::uint32_t>(size);
+    record->used = static_cast<std::uint32_t>(used);
+    record->position.store(position + 1, std::memory_order_release);
+}
+
+void MpscSink::wait_space(const std::uint64_t end) const noexcept
+{
+    while(end - m_read.load(std::memory_order_acquire) > m_capacity)
+    {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace usf
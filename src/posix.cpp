@@ -0,0 +1,438 @@
+#include <usf/usf_posix.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace usf::posix {
+
+ssize_t write_iov(const int fd, const IoVec* const iov, const int count) noexcept
+{
+    // Pieces handed to each writev() call
+    constexpr int kBatch = 16;
+
+    ssize_t total = 0;
+
+    // Next piece to write and the bytes of it already written
+    int            next   = 0;
+    std::ptrdiff_t offset = 0;
+
+    while(next < count)
+    {
+        ::iovec batch[kBatch];
+        int batch_count = 0;
+
+        for(int n = next; n < count && batch_count < kBatch; ++n, ++batch_count)
+        {
+            const std::ptrdiff_t skip = (n == next) ? offset : 0;
+
+            // writev() doesn't write to the buffers
+            batch[batch_count].iov_base = const_cast<CharType*>(iov[n].data + skip);
+            batch[batch_count].iov_len  = static_cast<std::size_t>(iov[n].size - skip);
+        }
+
+        const ssize_t written = ::writev(fd, batch, batch_count);
+
+        if(written < 0 && errno == EINTR) {
+            continue;
+        }
+        if(written <= 0) {
+            return ssize_t(error::io_error);
+        }
+
+        total += written;
+
+        // Skip the pieces written, resume a partial write.
+        std::ptrdiff_t left = written;
+
+        while(next < count && left >= iov[next].size - offset)
+        {
+            left -= iov[next].size - offset;
+            offset = 0;
+            ++next;
+        }
+        offset += left;
+    }
+    return total;
+}
+
+// ----------------------------------------------------------------------------
+// MEMORY-MAPPED FILE SINK
+// ----------------------------------------------------------------------------
+
+namespace {
+
+constexpr char kMmapMagic[8] = {'U', 'S', 'F', 'L', 'O', 'G', '0', '1'};
+
+}
+
+error MmapSink::open(const char* path, const std::size_t capacity, const std::size_t grow_step,
+                     const std::ptrdiff_t max_record) noexcept
+{
+    close();
+
+    if(capacity <= kHeaderSize || grow_step == 0 || max_record <= 0) {
+        return error::value_overflow;
+    }
+
+    m_fd = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if(m_fd < 0) {
+        return error::io_error;
+    }
+
+    struct stat st{};
+    if(::fstat(m_fd, &st) != 0) {
+        close();
+        return error::io_error;
+    }
+
+    const bool created = (static_cast<std::uint64_t>(st.st_size) < kHeaderSize);
+
+    if(created && ::ftruncate(m_fd, static_cast<off_t>(kHeaderSize)) != 0) {
+        close();
+        return error::io_error;
+    }
+
+    void* const map = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if(map == MAP_FAILED) {
+        close();
+        return error::io_error;
+    }
+
+    m_map        = static_cast<CharType*>(map);
+    m_capacity   = capacity - kHeaderSize;
+    m_grow_step  = grow_step;
+    m_max_record = max_record;
+
+    if(created)
+    {
+        std::memcpy(m_map, kMmapMagic, sizeof(kMmapMagic));
+        m_committed = new (m_map + sizeof(kMmapMagic)) std::atomic<std::uint64_t>(0);
+    }
+    else
+    {
+        if(std::memcmp(m_map, kMmapMagic, sizeof(kMmapMagic)) != 0) {
+            close();
+            return error::io_error;
+        }
+        m_committed = static_cast<std::atomic<std::uint64_t>*>(static_cast<void*>(m_map + sizeof(kMmapMagic)));
+    }
+
+    // Recovery: records committed after the committed length (a crash
+    // before advance()) are kept, anything else after them is dropped.
+    const std::uint64_t file_size = created ? kHeaderSize : std::min<std::uint64_t>(static_cast<std::uint64_t>(st.st_size), capacity);
+    std::uint64_t committed = std::min(m_committed->load(std::memory_order_acquire), file_size - kHeaderSize);
+
+    while(committed + sizeof(RecordHeader) <= file_size - kHeaderSize)
+    {
+        const RecordHeader* const record = header(committed);
+
+        if((record->state.load(std::memory_order_acquire) & kCommitted) == 0
+        || committed + record_size(record->size) > file_size - kHeaderSize) {
+            break;
+        }
+        committed += record_size(record->size);
+    }
+
+    m_committed->store(committed, std::memory_order_release);
+    m_reserved.store(committed, std::memory_order_relaxed);
+
+    // The space after the records reads back as zeros when the file grows
+    m_file_size.store(kHeaderSize + committed, std::memory_order_relaxed);
+    if(::ftruncate(m_fd, static_cast<off_t>(kHeaderSize + committed)) != 0) {
+        close();
+        return error::io_error;
+    }
+    return error::success;
+}
+
+void MmapSink::close() noexcept
+{
+    if(m_map != nullptr)
+    {
+        advance();
+
+        const std::uint64_t committed = this->committed();
+
+        ::munmap(m_map, m_capacity + kHeaderSize);
+
+        // Drops the space grown but not committed
+        static_cast<void>(::ftruncate(m_fd, static_cast<off_t>(kHeaderSize + committed)));
+    }
+
+    if(m_fd >= 0) {
+        ::close(m_fd);
+    }
+
+    m_fd        = -1;
+    m_map       = nullptr;
+    m_committed = nullptr;
+    m_reserved.store(0, std::memory_order_relaxed);
+    m_file_size.store(0, std::memory_order_relaxed);
+}
+
+std::pair<error, MmapSink::Record> MmapSink::reserve(const std::ptrdiff_t size) noexcept
+{
+    if(m_map == nullptr || size <= 0 || static_cast<std::uint64_t>(size) >= kCommitted) {
+        return {error::buf_overflow, {StringSpan(nullptr, nullptr), 0}};
+    }
+
+    const std::uint64_t total = record_size(static_cast<std::uint64_t>(size));
+    std::uint64_t offset = m_reserved.load(std::memory_order_relaxed);
+
+    // The record is published in the append offset once it fits and the
+    // file covers it: a reservation failing leaves no gap the committed
+    // length would stop at, the committed records stay contiguous.
+    do
+    {
+        if(offset + total > m_capacity) {
+            return {error::buf_overflow, {StringSpan(nullptr, nullptr), 0}};
+        }
+
+        if(m_file_size.load(std::memory_order_acquire) < kHeaderSize + offset + total)
+        {
+            if(auto err = grow(kHeaderSize + offset + total); err != error::success) {
+                return {err, {StringSpan(nullptr, nullptr), 0}};
+            }
+        }
+    }
+    while(!m_reserved.compare_exchange_weak(offset, offset + total, std::memory_order_relaxed));
+
+    RecordHeader* const record = header(offset);
+    record->size = static_cast<std::uint32_t>(size);
+
+    return {error::success, {StringSpan(reinterpret_cast<CharType*>(record + 1), size), offset}};
+}
+
+void MmapSink::commit(const Record& record, const std::ptrdiff_t used) noexcept
+{
+    // Sequentially consistent with advance(): either this writer sees the
+    // previous record committed or the previous writer sees this one.
+    header(record.offset)->state.store(static_cast<std::uint32_t>(used) | kCommitted, std::memory_order_seq_cst);
+    advance();
+}
+
+void MmapSink::shrink(const Record& record, const std::ptrdiff_t used) noexcept
+{
+    RecordHeader* const record_header = header(record.offset);
+
+    std::uint64_t end = record.offset + record_size(record_header->size);
+    const std::uint64_t used_end = record.offset + record_size(static_cast<std::uint64_t>(used));
+
+    // The space released reads as zeros (the headers of the next records),
+    // the size is published by commit().
+    if(used_end < end && m_reserved.compare_exchange_strong(end, used_end, std::memory_order_relaxed)) {
+        record_header->size = static_cast<std::uint32_t>(used);
+    }
+}
+
+void MmapSink::advance() noexcept
+{
+    std::uint64_t committed = m_committed->load(std::memory_order_seq_cst);
+
+    // Stops at the first record not committed yet (or not reserved yet, its
+    // header reads as zeros).
+    while(committed + sizeof(RecordHeader) <= m_file_size.load(std::memory_order_acquire) - kHeaderSize)
+    {
+        const RecordHeader* const record = header(committed);
+
+        if((record->state.load(std::memory_order_seq_cst) & kCommitted) == 0) {
+            break;
+        }
+
+        // On failure another writer advanced it, resume from there.
+        const std::uint64_t next = committed + record_size(record->size);
+        if(m_committed->compare_exchange_weak(committed, next, std::memory_order_seq_cst)) {
+            committed = next;
+        }
+    }
+}
+
+error MmapSink::grow(const std::uint64_t size) noexcept
+{
+    const std::lock_guard<std::mutex> lock(m_grow_mutex);
+
+    if(m_file_size.load(std::memory_order_relaxed) < size)
+    {
+        const std::uint64_t steps = (size + m_grow_step - 1) / m_grow_step;
+        const std::uint64_t file_size = std::min(steps * m_grow_step, m_capacity + kHeaderSize);
+
+        if(::ftruncate(m_fd, static_cast<off_t>(file_size)) != 0) {
+            return error::io_error;
+        }
+        m_file_size.store(file_size, std::memory_order_release);
+    }
+    return error::success;
+}
+
+error MmapSink::sync() noexcept
+{
+    if(m_map == nullptr || ::msync(m_map, m_file_size.load(std::memory_order_acquire), MS_SYNC) != 0) {
+        return error::io_error;
+    }
+    return error::success;
+}
+
+// ----------------------------------------------------------------------------
+// ASYNCHRONOUS FILE SINK
+// ----------------------------------------------------------------------------
+
+namespace {
+
+// Writes all of `size` bytes, resuming partial writes.
+bool write_all(const int fd, const CharType* data, std::ptrdiff_t size) noexcept
+{
+    while(size > 0)
+    {
+        const ssize_t written = ::write(fd, data, static_cast<std::size_t>(size));
+
+        if(written < 0 && errno == EINTR) {
+            continue;
+        }
+        if(written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+}
+
+AsyncFileSink::AsyncFileSink(const int fd, const AsyncFileConfig& config)
+    : m_fd(fd), m_config(config), m_buffers(static_cast<std::size_t>(std::max(config.buffer_count, 2))),
+      m_free(), m_full(m_buffers.size()), m_mutex(), m_flusher_cv(), m_writer_cv(), m_thread()
+{
+    for(std::size_t n = 0; n < m_buffers.size(); ++n)
+    {
+        m_buffers[n].data.reset(new CharType[static_cast<std::size_t>(m_config.buffer_size)]);
+        m_free.push_back(static_cast<int>(n));
+    }
+
+    m_thread = std::thread([this]() { run(); });
+}
+
+AsyncFileSink::~AsyncFileSink()
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_flusher_cv.notify_one();
+    m_thread.join();
+}
+
+error AsyncFileSink::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_flush = true;
+    m_flusher_cv.notify_one();
+
+    m_writer_cv.wait(lock, [this]() {
+        return m_io_error || (!m_flush && m_full_count == 0 && !m_writing);
+    });
+
+    return m_io_error ? error::io_error : error::success;
+}
+
+error AsyncFileSink::acquire(std::unique_lock<std::mutex>& lock)
+{
+    if(m_free.empty())
+    {
+        if(m_config.overflow == AsyncFileConfig::Overflow::kDrop)
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return error::backpressure;
+        }
+
+        // Another formatting thread may take the buffer first, then it's
+        // shared.
+        m_writer_cv.wait(lock, [this]() { return !m_free.empty() || m_active >= 0 || m_io_error; });
+
+        if(m_io_error) {
+            return error::io_error;
+        }
+    }
+
+    if(m_active < 0)
+    {
+        m_active = m_free.back();
+        m_free.pop_back();
+    }
+    return error::success;
+}
+
+void AsyncFileSink::submit()
+{
+    m_full[(m_full_head + m_full_count) % m_full.size()] = m_active;
+    ++m_full_count;
+    m_active = -1;
+
+    m_flusher_cv.notify_one();
+}
+
+void AsyncFileSink::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for(;;)
+    {
+        const bool timeout = !m_flusher_cv.wait_for(lock, m_config.flush_interval, [this]() {
+            return m_full_count > 0 || m_flush || m_stop;
+        });
+
+        for(;;)
+        {
+            // Interval elapsed, flush or stop requested: the partially
+            // filled buffer goes too.
+            if(m_full_count == 0 && (timeout || m_flush || m_stop)
+            && m_active >= 0 && m_buffers[static_cast<std::size_t>(m_active)].size > 0) {
+                submit();
+            }
+
+            if(m_full_count == 0) {
+                break;
+            }
+
+            const int index = m_full[m_full_head];
+            m_full_head = (m_full_head + 1) % m_full.size();
+            --m_full_count;
+
+            Buffer& buffer = m_buffers[static_cast<std::size_t>(index)];
+
+            // Written without the lock, formatting goes on in other buffers.
+            m_writing = true;
+            lock.unlock();
+            const bool written = write_all(m_fd, buffer.data.get(), buffer.size);
+            lock.lock();
+            m_writing = false;
+
+            if(!written) {
+                m_io_error = true;
+            }
+
+            buffer.size = 0;
+            m_free.push_back(index);
+            m_writer_cv.notify_all();
+        }
+
+        if(m_flush)
+        {
+            m_flush = false;
+            m_writer_cv.notify_all();
+        }
+
+        if(m_stop) {
+            break;
+        }
+    }
+}
+
+}
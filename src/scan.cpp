@@ -0,0 +1,306 @@
+#include <usf/usf.hpp>
+
+namespace usf::internal {
+
+namespace {
+
+inline bool is_space(const CharType ch) noexcept
+{
+    return ch == ' ' || (ch >= '\t' && ch <= '\r');
+}
+
+inline int integer_base(const ArgFormat& format) noexcept
+{
+    return format.type_is_integer_hex() ? 16
+         : format.type_is_integer_oct() ?  8
+         : format.type_is_integer_bin() ?  2 : 10;
+}
+
+// Input not holding the value expected doesn't match the format string
+inline error scan_error(const error err) noexcept
+{
+    return (err == error::inv_format) ? error::no_match : err;
+}
+
+template <typename T, typename Value = T>
+error scan_integer(const CharType*& it, const CharType* const end, const ArgFormat& format, void* const pointer) noexcept
+{
+    const auto [err, value, rest] = parse_integer<T>(StringView(it, end), integer_base(format), format.hash());
+
+    if(err != error::success) {
+        return scan_error(err);
+    }
+
+    *static_cast<Value*>(pointer) = static_cast<Value>(value);
+    it = rest.cbegin();
+    return error::success;
+}
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+template <typename T>
+error scan_float(const CharType*& it, const CharType* const end, void* const pointer) noexcept
+{
+    const auto [err, value, rest] = parse<T>(StringView(it, end));
+
+    if(err != error::success) {
+        return scan_error(err);
+    }
+
+    *static_cast<T*>(pointer) = value;
+    it = rest.cbegin();
+    return error::success;
+}
+#endif
+
+// Matches the literal text at the beginning of `fmt` (up to the next
+// argument field) with the beginning of `input`, removing it from both.
+error match_literal(StringView& input, StringView& fmt) noexcept
+{
+    const CharType* in_it  = input.cbegin();
+    const CharType* fmt_it = fmt.cbegin();
+
+    while(fmt_it < fmt.cend())
+    {
+        if(*fmt_it == '{')
+        {
+            if(fmt_it + 1 < fmt.cend() && *(fmt_it + 1) == '{')
+            {
+                // Found '{{' escape character, skip the first '{'.
+                ++fmt_it;
+            }
+            else
+            {
+                // A type format should follow...
+                break;
+            }
+        }
+        else if(*fmt_it == '}')
+        {
+            //USF_ENFORCE(*(fmt_it + 1) == '}', std::runtime_error);
+            if(!(fmt_it + 1 < fmt.cend() && *(fmt_it + 1) == '}')) {
+                return error::arg_enclose;
+            }
+
+            // Found '}}' escape character, skip the first '}'.
+            ++fmt_it;
+        }
+
+        //USF_ENFORCE(*in_it == *fmt_it, std::runtime_error);
+        if(in_it == input.cend() || *in_it != *fmt_it) {
+            return error::no_match;
+        }
+        ++in_it;
+        ++fmt_it;
+    }
+
+    input.remove_prefix(in_it - input.cbegin());
+    fmt.remove_prefix(fmt_it - fmt.cbegin());
+    return error::success;
+}
+
+// End of a string field without width followed by `fmt`
+inline int next_delimiter(const StringView fmt) noexcept
+{
+    if(fmt.empty()) {
+        return ScanArgument::kToEnd;
+    }
+    if(fmt[0] == '{' && !(fmt.size() > 1 && fmt[1] == '{')) {
+        return ScanArgument::kToSpace;
+    }
+    return static_cast<unsigned char>(fmt[0]);
+}
+
+} // namespace
+
+error ScanArgument::scan(StringView& input, const ArgFormat& format, const int delimiter) const noexcept
+{
+    const ArgKind kind = (m_type_id == TypeId::kBool) ? ArgKind::kBool
+                       : (m_type_id == TypeId::kChar) ? ArgKind::kChar
+                       : (m_type_id == TypeId::kString) ? ArgKind::kString
+                       : (m_type_id >= TypeId::kFloat) ? ArgKind::kFloat : ArgKind::kInteger;
+
+    if(auto err = check_scan_argument(format, kind); err != error::success) {
+        return err;
+    }
+
+    const CharType* it  = input.cbegin();
+    const CharType* end = input.cend();
+
+    // A field with a width is the next `width` characters, the value and
+    // its fill characters.
+    const bool fixed_width = format.width() > 0;
+
+    if(fixed_width)
+    {
+        //USF_ENFORCE(format.width() <= input.size(), std::runtime_error);
+        if(format.width() > input.size()) {
+            return error::no_match;
+        }
+        end = it + format.width();
+
+        if(format.align() != ArgFormat::Align::kNumeric)
+        {
+            // Keeps one character at least (zero filled zero values)
+            const CharType fill = format.fill_char();
+
+            while(end - it > 1 && *it == fill) { ++it; }
+            while(end - it > 1 && *(end - 1) == fill) { --end; }
+        }
+    }
+
+    const CharType* const field_end = fixed_width ? input.cbegin() + format.width() : nullptr;
+
+    if(kind == ArgKind::kInteger || kind == ArgKind::kFloat)
+    {
+        if(format.sign() >= ArgFormat::Sign::kPlus && it < end && (*it == '+' || *it == ' '))
+        {
+            ++it;
+
+            //USF_ENFORCE(*it != '-', std::runtime_error);
+            if(it < end && *it == '-') {
+                return error::no_match;
+            }
+        }
+    }
+
+    using CharInteger = typename std::conditional<std::is_signed<CharType>::value, int8_t, uint8_t>::type;
+
+    error err = error::success;
+
+    switch(m_type_id)
+    {
+        case TypeId::kBool:
+            if(format.type_is_integer())
+            {
+                uint8_t value = 0;
+                err = scan_integer<uint8_t>(it, end, format, &value);
+
+                if(err == error::success) {
+                    *static_cast<bool*>(m_pointer) = (value != 0);
+                }
+            }
+            else if(end - it >= 4 && CharTraits::equal(it, "true", 4))
+            {
+                *static_cast<bool*>(m_pointer) = true;
+                it += 4;
+            }
+            else if(end - it >= 5 && CharTraits::equal(it, "false", 5))
+            {
+                *static_cast<bool*>(m_pointer) = false;
+                it += 5;
+            }
+            else
+            {
+                err = error::no_match;
+            }
+            break;
+
+        case TypeId::kChar:
+            if(format.type_is_integer())
+            {
+                err = scan_integer<CharInteger, CharType>(it, end, format, m_pointer);
+            }
+            else if(it < end)
+            {
+                *static_cast<CharType*>(m_pointer) = *it++;
+            }
+            else
+            {
+                err = error::no_match;
+            }
+            break;
+
+        case TypeId::kInt8:   err = scan_integer<int8_t  >(it, end, format, m_pointer); break;
+        case TypeId::kUint8:  err = scan_integer<uint8_t >(it, end, format, m_pointer); break;
+        case TypeId::kInt16:  err = scan_integer<int16_t >(it, end, format, m_pointer); break;
+        case TypeId::kUint16: err = scan_integer<uint16_t>(it, end, format, m_pointer); break;
+        case TypeId::kInt32:  err = scan_integer<int32_t >(it, end, format, m_pointer); break;
+        case TypeId::kUint32: err = scan_integer<uint32_t>(it, end, format, m_pointer); break;
+        case TypeId::kInt64:  err = scan_integer<int64_t >(it, end, format, m_pointer); break;
+        case TypeId::kUint64: err = scan_integer<uint64_t>(it, end, format, m_pointer); break;
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+        case TypeId::kFloat:  err = scan_float<float >(it, end, m_pointer); break;
+        case TypeId::kDouble: err = scan_float<double>(it, end, m_pointer); break;
+#else
+        case TypeId::kFloat:
+        case TypeId::kDouble: err = error::arg_type; break;
+#endif
+
+        case TypeId::kString:
+        {
+            const CharType* const limit = (format.precision() >= 0 && format.precision() < end - it)
+                                        ? it + format.precision() : end;
+            const CharType* const begin = it;
+
+            if(fixed_width || delimiter == kToEnd) {
+                it = limit;
+            }
+            else if(delimiter == kToSpace) {
+                while(it < limit && !is_space(*it)) { ++it; }
+            }
+            else {
+                while(it < limit && *it != static_cast<CharType>(delimiter)) { ++it; }
+            }
+
+            *static_cast<StringView*>(m_pointer) = StringView(begin, it);
+            break;
+        }
+    }
+
+    if(err != error::success) {
+        return err;
+    }
+
+    // The value spans the whole field
+    //USF_ENFORCE(!fixed_width || it == end, std::runtime_error);
+    if(fixed_width && it != end) {
+        return error::no_match;
+    }
+
+    input.remove_prefix((fixed_width ? field_end : it) - input.cbegin());
+    return error::success;
+}
+
+error scan(StringView& input, StringView fmt, const ScanArgument* const args, const int arg_count, int& count) noexcept
+{
+    // Argument's sequential index
+    int arg_seq_index = 0;
+
+    if(auto err = match_literal(input, fmt); err != error::success) {
+        return err;
+    }
+
+    while(!fmt.empty())
+    {
+        const ArgFormat format(fmt, arg_count);
+
+        if(format.ec_error() != error::success) {
+            return format.ec_error();
+        }
+
+        // Determine which argument index to use, sequential or positional.
+        int arg_index = format.index();
+
+        if(arg_index < 0)
+        {
+            //USF_ENFORCE(arg_seq_index < arg_count, std::runtime_error);
+            if(arg_seq_index >= arg_count) {
+                return error::arg_index_too_large;
+            }
+            arg_index = arg_seq_index++;
+        }
+
+        if(auto err = args[arg_index].scan(input, format, next_delimiter(fmt)); err != error::success) {
+            return err;
+        }
+        ++count;
+
+        if(auto err = match_literal(input, fmt); err != error::success) {
+            return err;
+        }
+    }
+    return error::success;
+}
+
+} // namespace usf::internal
@@ -0,0 +1,88 @@
+#include <usf/usf.hpp>
+
+namespace usf::internal {
+
+error process_iov(IoVecSpan& iov, usf::StringSpan& scratch, usf::StringView fmt,
+                  const Argument* const args, const int arg_count, const usf::StringView* const names)
+{
+    // Argument's sequential index
+    int arg_seq_index = 0;
+
+    // Literal text not appended yet
+    const CharType* literal = fmt.cbegin();
+    const CharType* fmt_it = fmt.cbegin();
+
+    while(fmt_it < fmt.cend())
+    {
+        if(*fmt_it == '{' && fmt_it + 1 < fmt.cend() && *(fmt_it + 1) == '{')
+        {
+            // Found '{{' escape character, keep the first '{' and skip the second.
+            if(auto err=iov.append(literal, fmt_it + 1 - literal); err!=error::success) {
+                return err;
+            }
+            fmt_it += 2;
+            literal = fmt_it;
+        }
+        else if(*fmt_it == '{')
+        {
+            if(auto err=iov.append(literal, fmt_it - literal); err!=error::success) {
+                return err;
+            }
+
+            usf::StringView spec(fmt_it, fmt.cend());
+            ArgFormat format(spec, arg_count, names, (names != nullptr) ? arg_count : 0);
+
+            if(format.ec_error()!=error::success) {
+                return format.ec_error();
+            }
+
+            // Determine which argument index to use, sequential or positional.
+            int arg_index = format.index();
+
+            if(arg_index < 0)
+            {
+                //USF_ENFORCE(arg_seq_index < arg_count, std::runtime_error);
+                if(arg_seq_index >= arg_count) {
+                    return error::arg_index_too_large;
+                }
+                arg_index = arg_seq_index++;
+            }
+
+            // Only the argument fields are rendered
+            const CharType* const field = scratch.begin();
+
+            if(auto err=args[arg_index].format(scratch, format); err!=error::success) {
+                return err;
+            }
+
+            if(auto err=iov.append(field, scratch.begin() - field); err!=error::success) {
+                return err;
+            }
+
+            fmt_it = spec.cbegin();
+            literal = fmt_it;
+        }
+        else if(*fmt_it == '}')
+        {
+            //USF_ENFORCE(*(fmt_it + 1) == '}', std::runtime_error);
+            if(fmt_it + 1 >= fmt.cend() || *(fmt_it + 1) != '}') {
+                return error::arg_enclose;
+            }
+
+            // Found '}}' escape character, keep the first '}' and skip the second.
+            if(auto err=iov.append(literal, fmt_it + 1 - literal); err!=error::success) {
+                return err;
+            }
+            fmt_it += 2;
+            literal = fmt_it;
+        }
+        else
+        {
+            ++fmt_it;
+        }
+    }
+
+    return iov.append(literal, fmt_it - literal);
+}
+
+}
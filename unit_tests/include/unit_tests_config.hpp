@@ -34,6 +34,14 @@
 #define USF_TEST_FORMAT_SPEC
 #define USF_TEST_POSITIONAL_ARGS
 #define USF_TEST_CUSTOM_TYPES
+#define USF_TEST_RANGES
+#define USF_TEST_INTEGERS
+#define USF_TEST_COMPILE_TIME
+#define USF_TEST_SINKS
+#define USF_TEST_PARSE
+#define USF_TEST_SCAN
+#define USF_TEST_ESCAPED_STRINGS
+#define USF_TEST_JSON
 //#define USF_TEST_FLOATING_POINT
 #define USF_TEST_BENCHMARKS
 #define USF_TEST_BENCHMARK_PRINTF
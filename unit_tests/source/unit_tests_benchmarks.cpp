@@ -3,7 +3,14 @@
 
 #if defined(USF_TEST_BENCHMARKS)
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #if defined(USF_TEST_BENCHMARK_FMT)
 #define FMT_HEADER_ONLY
@@ -183,4 +190,489 @@ TEST_CASE("usf::format_to, benchmark")
 #endif
 }
 
+// ----------------------------------------------------------------------------
+// BENCHMARK - BINARY / OCTAL CONVERSION
+// ----------------------------------------------------------------------------
+// Reference: the previous one character per iteration converters.
+static void loop_convert_bin(char* dst, uint32_t value)
+{
+    do
+    {
+        const uint32_t v = value;
+        value >>= 1U;
+        *(--dst) = static_cast<char>('0' + (v - (value << 1U)));
+    }while(value);
+}
+
+static void loop_convert_oct(char* dst, uint32_t value)
+{
+    do
+    {
+        const uint32_t v = value;
+        value >>= 3U;
+        *(--dst) = static_cast<char>('0' + (v - (value << 3U)));
+    }while(value);
+}
+
+TEST_CASE("usf::internal::Integer, binary / octal conversion benchmark")
+{
+    const int max_runs = 10;
+    const int max_iterations = 2000000;
+
+    auto ms_min_bin_loop = std::numeric_limits<int64_t>::max();
+    auto ms_min_bin_usf  = std::numeric_limits<int64_t>::max();
+    auto ms_min_oct_loop = std::numeric_limits<int64_t>::max();
+    auto ms_min_oct_usf  = std::numeric_limits<int64_t>::max();
+
+    char str_loop[40]{};
+    char str_usf [40]{};
+
+    for(int r = 0; r < max_runs; ++r)
+    {
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(uint32_t i = 0; i < max_iterations; ++i)
+            {
+                loop_convert_bin(str_loop + 32, 0x80000000U | i);
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_bin_loop = std::min(ms_min_bin_loop, ms);
+        }
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(uint32_t i = 0; i < max_iterations; ++i)
+            {
+                usf::internal::Integer::convert_bin(str_usf + 32, 0x80000000U | i);
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_bin_usf = std::min(ms_min_bin_usf, ms);
+        }
+        CHECK_EQ(str_usf, str_loop);
+
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(uint32_t i = 0; i < max_iterations; ++i)
+            {
+                loop_convert_oct(str_loop + 11, 0xC0000000U | i);
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_oct_loop = std::min(ms_min_oct_loop, ms);
+        }
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(uint32_t i = 0; i < max_iterations; ++i)
+            {
+                usf::internal::Integer::convert_oct(str_usf + 11, 0xC0000000U | i);
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_oct_usf = std::min(ms_min_oct_usf, ms);
+        }
+        str_loop[11] = str_usf[11] = '\0';
+        CHECK_EQ(str_usf, str_loop);
+    }
+
+    std::cout << "BEST RESULTS (binary 32 digits / octal 11 digits):\n";
+    std::cout << "LOOP: " << ms_min_bin_loop << "ms / " << ms_min_oct_loop << "ms\n";
+    std::cout << "USF:  " << ms_min_bin_usf  << "ms / " << ms_min_oct_usf  << "ms\n";
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK - MULTIPLE PRODUCERS SINK CONTENTION
+// ----------------------------------------------------------------------------
+// Reference: a mutex guarding a ring of records, the producers formatting
+// into it and waiting for the consumer when it's full, as MpscSink does.
+class MutexSink
+{
+    public:
+
+        template <typename... Args>
+        void format(usf::StringView fmt, Args&&... args)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_not_full.wait(lock, [this]() { return m_tail - m_head < kRecords; });
+
+            Record& record = m_records[m_tail++ % kRecords];
+
+            const auto [err, str] = usf::basic_format_to(usf::StringSpan(record.text, 64), fmt, args...);
+            record.size = (err == usf::error::success) ? str.size() : 0;
+        }
+
+        // Consumer: calls `func(StringView)` with the records formatted
+        // and releases their space. Returns the number of records read.
+        template <typename Func>
+        int poll(Func&& func)
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+
+            const int count = static_cast<int>(m_tail - m_head);
+            for(; m_head < m_tail; ++m_head)
+            {
+                const Record& record = m_records[m_head % kRecords];
+                func(usf::StringView(record.text, record.size));
+            }
+            m_not_full.notify_all();
+            return count;
+        }
+
+    private:
+
+        static constexpr std::uint64_t kRecords = 1 << 14;
+
+        struct Record
+        {
+            char           text[64];
+            std::ptrdiff_t size;
+        };
+
+        std::mutex              m_mutex{};
+        std::condition_variable m_not_full{};
+        std::vector<Record>     m_records = std::vector<Record>(kRecords);
+        std::uint64_t           m_head = 0;
+        std::uint64_t           m_tail = 0;
+};
+
+TEST_CASE("usf::MpscSink, contention benchmark")
+{
+    const int max_runs = 3;
+    const int max_records = 1 << 18;
+
+    std::vector<char> storage(1 << 20);
+
+    std::cout << "BEST RESULTS (" << max_records << " records, producers: mpsc / mutex):\n";
+
+    for(int thread_count = 1; thread_count <= 64; thread_count *= 2)
+    {
+        auto ms_min_mpsc  = std::numeric_limits<int64_t>::max();
+        auto ms_min_mutex = std::numeric_limits<int64_t>::max();
+
+        const int records = max_records / thread_count;
+
+        for(int r = 0; r < max_runs; ++r)
+        {
+            {
+                usf::MpscSink sink(usf::StringSpan(storage.data(), static_cast<std::ptrdiff_t>(storage.size())), 64);
+                std::atomic<int> running{thread_count};
+                int count = 0;
+
+                auto start = std::chrono::steady_clock::now();
+
+                std::vector<std::thread> threads;
+                for(int t = 0; t < thread_count; ++t)
+                {
+                    threads.emplace_back([&sink, &running, records, t]() noexcept
+                    {
+                        for(int i = 0; i < records; ++i) { sink.format("thread {:2d} record {:08x}", t, i); }
+                        --running;
+                    });
+                }
+
+                while(running > 0)
+                {
+                    const int polled = sink.poll([](usf::StringView) {});
+                    if(polled == 0) { std::this_thread::yield(); }
+                    count += polled;
+                }
+                for(auto& thread : threads) { thread.join(); }
+                count += sink.poll([](usf::StringView) {});
+
+                auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+                ms_min_mpsc = std::min(ms_min_mpsc, ms);
+                CHECK_EQ(count, records * thread_count);
+            }
+            {
+                MutexSink sink;
+                std::atomic<int> running{thread_count};
+                int count = 0;
+
+                auto start = std::chrono::steady_clock::now();
+
+                std::vector<std::thread> threads;
+                for(int t = 0; t < thread_count; ++t)
+                {
+                    threads.emplace_back([&sink, &running, records, t]()
+                    {
+                        for(int i = 0; i < records; ++i) { sink.format("thread {:2d} record {:08x}", t, i); }
+                        --running;
+                    });
+                }
+
+                while(running > 0)
+                {
+                    const int polled = sink.poll([](usf::StringView) {});
+                    if(polled == 0) { std::this_thread::yield(); }
+                    count += polled;
+                }
+                for(auto& thread : threads) { thread.join(); }
+                count += sink.poll([](usf::StringView) {});
+
+                auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+                ms_min_mutex = std::min(ms_min_mutex, ms);
+                CHECK_EQ(count, records * thread_count);
+            }
+        }
+
+        std::cout << thread_count << ": " << ms_min_mpsc << "ms / " << ms_min_mutex << "ms\n";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK - INTEGER PARSING
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::parse, benchmark")
+{
+    const int max_runs = 10;
+    const int max_values = 1000;
+    const int max_iterations = 2000;
+
+    // Decimal digit counts from 1 to 20
+    std::vector<std::string> values;
+    uint64_t value = 7;
+    for(int i = 0; i < max_values; ++i)
+    {
+        values.push_back(std::to_string(value >> (i % 64)));
+        value = value * 6364136223846793005U + 1442695040888963407U;
+    }
+
+    auto ms_min_std = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf = std::numeric_limits<int64_t>::max();
+
+    uint64_t sum_std = 0;
+    uint64_t sum_usf = 0;
+
+    for(int r = 0; r < max_runs; ++r)
+    {
+        sum_std = sum_usf = 0;
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto& str : values) { sum_std += std::strtoull(str.c_str(), nullptr, 10); }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_std = std::min(ms_min_std, ms);
+        }
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto& str : values) { sum_usf += usf::parse<uint64_t>(usf::StringView(str)).value; }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_usf = std::min(ms_min_usf, ms);
+        }
+        CHECK_EQ(sum_usf, sum_std);
+    }
+
+    std::cout << "BEST RESULTS (" << max_values * max_iterations << " decimal values):\n";
+    std::cout << "STRTOULL: " << ms_min_std << "ms\n";
+    std::cout << "USF:      " << ms_min_usf << "ms\n";
+}
+
+TEST_CASE("usf::scan, benchmark")
+{
+    const int max_runs = 10;
+    const int max_values = 1000;
+    const int max_iterations = 200;
+
+    // Log lines: "<time> [<level>] <hexadecimal code> <message>"
+    std::vector<std::string> lines;
+    uint64_t value = 7;
+    for(int i = 0; i < max_values; ++i)
+    {
+        char line[128]{};
+        usf::format_to(line, 128, "{} [{}] {:x} message", value >> 40, (i % 3 == 0) ? "warn" : "info", value & 0xFFFFU);
+        lines.emplace_back(line);
+        value = value * 6364136223846793005U + 1442695040888963407U;
+    }
+
+    auto ms_min_std = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf_parsed = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf_compiled = std::numeric_limits<int64_t>::max();
+
+    uint64_t sum_std = 0, sum_usf = 0, sum_usf_parsed = 0, sum_usf_compiled = 0;
+
+    const usf::ScanFormat<> parsed("{} [{}] {:x} ");
+
+    for(int r = 0; r < max_runs; ++r)
+    {
+        sum_std = sum_usf = sum_usf_parsed = sum_usf_compiled = 0;
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto& line : lines)
+                {
+                    unsigned long long time = 0; unsigned int code = 0; char level[8]{};
+                    std::sscanf(line.c_str(), "%llu [%7[^]]] %x ", &time, level, &code);
+                    sum_std += static_cast<uint64_t>(time) + code + static_cast<uint64_t>(level[0]);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_std = std::min(ms_min_std, ms);
+        }
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto& line : lines)
+                {
+                    uint64_t time = 0; uint32_t code = 0; usf::StringView level("");
+                    static_cast<void>(usf::scan(usf::StringView(line), "{} [{}] {:x} ", time, level, code));
+                    sum_usf += time + code + static_cast<uint64_t>(level[0]);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_usf = std::min(ms_min_usf, ms);
+        }
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto& line : lines)
+                {
+                    uint64_t time = 0; uint32_t code = 0; usf::StringView level("");
+                    static_cast<void>(usf::scan(usf::StringView(line), parsed, time, level, code));
+                    sum_usf_parsed += time + code + static_cast<uint64_t>(level[0]);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_usf_parsed = std::min(ms_min_usf_parsed, ms);
+        }
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                for(const auto& line : lines)
+                {
+                    uint64_t time = 0; uint32_t code = 0; usf::StringView level("");
+                    static_cast<void>(usf::scan(usf::StringView(line), USF_FMT("{} [{}] {:x} "), time, level, code));
+                    sum_usf_compiled += time + code + static_cast<uint64_t>(level[0]);
+                }
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_usf_compiled = std::min(ms_min_usf_compiled, ms);
+        }
+        CHECK_EQ(sum_usf, sum_std);
+        CHECK_EQ(sum_usf_parsed, sum_std);
+        CHECK_EQ(sum_usf_compiled, sum_std);
+    }
+
+    std::cout << "BEST RESULTS (" << max_values * max_iterations << " log lines):\n";
+    std::cout << "SSCANF:           " << ms_min_std << "ms\n";
+    std::cout << "USF:              " << ms_min_usf << "ms\n";
+    std::cout << "USF (ScanFormat): " << ms_min_usf_parsed << "ms\n";
+    std::cout << "USF (USF_FMT):    " << ms_min_usf_compiled << "ms\n";
+}
+
+TEST_CASE("usf::format_to, escaped strings benchmark")
+{
+    const int max_runs = 10;
+    const int max_iterations = 20000;
+
+    // Log message with a few characters to escape
+    std::string message;
+    for(int i = 0; i < 8; ++i) { message += "GET /index.html?user=\"guest\" HTTP/1.1\t"; }
+    message += "\n";
+
+    char str[1024]{};
+    char escaped[1024]{};
+
+    auto ms_min_std = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf = std::numeric_limits<int64_t>::max();
+
+    for(int r = 0; r < max_runs; ++r)
+    {
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                // Escaped into a temporary buffer first, a character at a time
+                char* it = escaped;
+                for(const char ch : message)
+                {
+                    switch(ch)
+                    {
+                        case '"':  *it++ = '\\'; *it++ = '"';  break;
+                        case '\\': *it++ = '\\'; *it++ = '\\'; break;
+                        case '\n': *it++ = '\\'; *it++ = 'n';  break;
+                        case '\t': *it++ = '\\'; *it++ = 't';  break;
+                        default:   *it++ = ch;                break;
+                    }
+                }
+                usf::format_to(str, 1024, "msg=\"{}\"", usf::StringView(escaped, it - escaped));
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_std = std::min(ms_min_std, ms);
+        }
+        const std::string expected(str);
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                usf::format_to(str, 1024, "msg={:?}", usf::StringView(message));
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_usf = std::min(ms_min_usf, ms);
+        }
+        CHECK_EQ(std::string(str), expected);
+    }
+
+    std::cout << "BEST RESULTS (" << max_iterations << " strings of " << message.size() << " characters):\n";
+    std::cout << "ESCAPE + {}: " << ms_min_std << "ms\n";
+    std::cout << "{:?}:        " << ms_min_usf << "ms\n";
+}
+
+TEST_CASE("usf::JsonWriter, benchmark")
+{
+    const int max_runs = 10;
+    const int max_iterations = 200000;
+
+    const usf::StringView message("GET /index.html?user=\"guest\" HTTP/1.1");
+
+    char str[256]{};
+
+    auto ms_min_std = std::numeric_limits<int64_t>::max();
+    auto ms_min_usf = std::numeric_limits<int64_t>::max();
+
+    for(int r = 0; r < max_runs; ++r)
+    {
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                // Log line built with chained format_to() calls
+                char* it = str;
+                it += usf::format_to(it, 256, "{{\"time\":{},\"level\":{:?},", 1234567890U + uint32_t(i), "info");
+                it += usf::format_to(it, 256 - (it - str), "\"msg\":{:?},\"code\":{},", message, -i);
+                usf::format_to(it, 256 - (it - str), "\"elapsed\":{},\"tags\":[{},{}]}}", 0.125, i, i + 1);
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_std = std::min(ms_min_std, ms);
+        }
+        const std::string expected(str);
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < max_iterations; ++i)
+            {
+                usf::JsonWriter json(usf::StringSpan(str, 256));
+                json.begin_object()
+                        .member("time", 1234567890U + uint32_t(i)).member("level", "info")
+                        .member("msg", message).member("code", -i)
+                        .member("elapsed", 0.125)
+                        .key("tags").begin_array().value(i).value(i + 1).end_array()
+                    .end_object();
+                (void)json.finish();
+            }
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            ms_min_usf = std::min(ms_min_usf, ms);
+        }
+        CHECK_EQ(std::string(str), expected);
+    }
+
+    std::cout << "BEST RESULTS (" << max_iterations << " JSON log lines):\n";
+    std::cout << "format_to(): " << ms_min_std << "ms\n";
+    std::cout << "JsonWriter:  " << ms_min_usf << "ms\n";
+}
+
 #endif //defined(USF_TEST_BENCHMARKS)
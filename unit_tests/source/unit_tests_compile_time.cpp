@@ -0,0 +1,339 @@
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_COMPILE_TIME)
+
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+// COMPILE-TIME FORMAT STRINGS
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, compile-time format string")
+{
+    char str[64]{};
+
+    CHECK_EQ(usf::format_to(str, 64, USF_FMT("Hello, world!")), 13);
+    CHECK_EQ(str, "Hello, world!");
+
+    CHECK_EQ(usf::format_to(str, 64, USF_FMT("{{{}}} {:>5} {:<5}|"), 42, "ab", 'c'), 17);
+    CHECK_EQ(str, "{42}    ab c    |");
+
+    usf::format_to(str, 64, USF_FMT("{:#06x} {:+d} {:o} {:b}"), 255, 42, 8, uint8_t(5));
+    CHECK_EQ(str, "0x00ff +42 10 101");
+
+    usf::format_to(str, 64, USF_FMT("{1}{0}{1} {}"), "abra", "cad");
+    CHECK_EQ(str, "cadabracad abra");
+
+    usf::format_to(str, 64, USF_FMT("{} {:d} {:,}"), true, false, 1234567);
+    CHECK_EQ(str, "true 0 1,234,567");
+
+    usf::format_to(str, 64, USF_FMT("{:.3s} {:s}"), "abcdef", std::string("str"));
+    CHECK_EQ(str, "abc str");
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    usf::format_to(str, 64, USF_FMT("{:.2f} {:e}"), 3.14159, 1.234);
+    CHECK_EQ(str, "3.14 1.234000e+00");
+#endif
+
+    const uint32_t values[]{1, 2, 3};
+    usf::format_to(str, 64, USF_FMT("[{}] {:X}"), usf::join(values, 3), usf::bytes(values, 1));
+    CHECK_EQ(str, "[1, 2, 3] 01");
+}
+
+TEST_CASE("usf::format_to, compile-time format string (buffer bounds)")
+{
+    char str[8]{};
+
+    CHECK_EQ(usf::format_to(str, 8, USF_FMT("1234567")), 7);
+    CHECK_EQ(usf::format_to(str, 8, USF_FMT("12345678")), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 8, USF_FMT("abc{}"), 1234), 7);
+    CHECK_EQ(usf::format_to(str, 8, USF_FMT("abc{}"), 12345), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 8, USF_FMT("{}abc"), 12345), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 0, USF_FMT("")), ssize_t(usf::error::buf_overflow));
+}
+
+TEST_CASE("usf::format_to, compile-time format string (validation)")
+{
+    struct Custom {};
+
+    // Build errors when used with usf::format_to(), tested here directly.
+    constexpr auto hex = USF_FMT("{:x}");
+    constexpr auto str = USF_FMT("{:s}");
+    constexpr auto custom = USF_FMT("{:d}");
+    constexpr auto grouping = USF_FMT("{:,}");
+    constexpr auto invalid = USF_FMT("{:q}");
+    constexpr auto index = USF_FMT("{2}");
+    constexpr auto brace = USF_FMT("{} }");
+
+    using Hex      = std::decay_t<decltype(hex)>;
+    using Str      = std::decay_t<decltype(str)>;
+    using CustomFmt = std::decay_t<decltype(custom)>;
+    using Grouping = std::decay_t<decltype(grouping)>;
+    using Invalid  = std::decay_t<decltype(invalid)>;
+    using Index    = std::decay_t<decltype(index)>;
+    using Brace    = std::decay_t<decltype(brace)>;
+
+    using usf::internal::CompiledFormat;
+
+    CHECK_EQ(CompiledFormat<Hex, int>::kArgumentError, usf::error::success);
+    CHECK_EQ(CompiledFormat<Hex, const char*>::kArgumentError, usf::error::arg_type);
+    CHECK_EQ(CompiledFormat<Hex, bool>::kArgumentError, usf::error::success);
+    CHECK_EQ(CompiledFormat<Str, int>::kArgumentError, usf::error::arg_type);
+    CHECK_EQ(CompiledFormat<Str, char>::kArgumentError, usf::error::type_mismatch);
+    CHECK_EQ(CompiledFormat<Str, std::string>::kArgumentError, usf::error::success);
+    CHECK_EQ(CompiledFormat<CustomFmt, Custom>::kArgumentError, usf::error::no_custom_format);
+    CHECK_EQ(CompiledFormat<Grouping, const char*>::kArgumentError, usf::error::inv_format);
+    CHECK_EQ(CompiledFormat<Grouping, uint64_t>::kArgumentError, usf::error::success);
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    CHECK_EQ(CompiledFormat<Grouping, double>::kArgumentError, usf::error::inv_format);
+#endif
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    CHECK_EQ(CompiledFormat<Hex, double>::kArgumentError, usf::error::type_mismatch);
+#endif
+
+    CHECK_EQ(CompiledFormat<Invalid, int>::kFormatError, usf::error::inv_type);
+    CHECK_EQ(CompiledFormat<Index, int, int>::kFormatError, usf::error::arg_index_too_large);
+    CHECK_EQ(CompiledFormat<Hex>::kFormatError, usf::error::no_format_arg);
+    CHECK_EQ(CompiledFormat<Brace, int>::kFormatError, usf::error::arg_enclose);
+}
+
+TEST_CASE("usf::max_formatted_size")
+{
+    CHECK_EQ(usf::max_formatted_size(USF_FMT("Hello, {{world}}!")), 16);
+
+    // Worst case values fill the buffer exactly
+    constexpr auto u64_size = usf::max_formatted_size<uint64_t>(USF_FMT("[{}]"));
+    static_assert(u64_size == 2 + 20 + 1, "");
+    std::array<char, u64_size> u64_str{};
+    CHECK_EQ(usf::format_to(u64_str.data(), u64_size, USF_FMT("[{}]"), UINT64_MAX), u64_size - 1);
+
+    constexpr auto i64_size = usf::max_formatted_size<int64_t>(USF_FMT("{:,}"));
+    std::array<char, i64_size> i64_str{};
+    CHECK_EQ(usf::format_to(i64_str.data(), i64_size, USF_FMT("{:,}"), INT64_MIN), i64_size - 1);
+    CHECK_EQ(i64_str.data(), "-9,223,372,036,854,775,808");
+
+    constexpr auto hex_size = usf::max_formatted_size<uint32_t, int8_t, char>(USF_FMT("{:#x} {:b} {:o}"));
+    std::array<char, hex_size> hex_str{};
+    CHECK_EQ(usf::format_to(hex_str.data(), hex_size, USF_FMT("{:#x} {:b} {:o}"), UINT32_MAX, int8_t(-128), char(-128)),
+             hex_size - 1);
+
+    // Width, precision and character arrays
+    CHECK_EQ(usf::max_formatted_size<int>(USF_FMT("{:40}")), 41);
+    CHECK_EQ(usf::max_formatted_size<uint8_t, bool>(USF_FMT("{:02x}{}")), 8);
+    CHECK_EQ(usf::max_formatted_size<const char*>(USF_FMT("{:.8s}")), 9);
+    CHECK_EQ(usf::max_formatted_size<std::string>(USF_FMT("{:>12.4s}")), 13);
+    CHECK_EQ(usf::max_formatted_size<const char(&)[6]>(USF_FMT("<{}>")), 8);
+    CHECK_EQ(usf::max_formatted_size<char, char>(USF_FMT("{}{:c}")), 3);
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    constexpr auto float_size = usf::max_formatted_size<double, double, double>(USF_FMT("{:.3f}|{:e}|{}"));
+    std::array<char, float_size> float_str{};
+    CHECK_GT(usf::format_to(float_str.data(), float_size, USF_FMT("{:.3f}|{:e}|{}"), -1.8e19, -1.2345678e-19, -1.23456e-4), 0);
+    CHECK_EQ(float_str.data(), "-18000000000000000000.000|-1.234568e-19|-0.000123456");
+#endif
+}
+
+// Formats `value` into a buffer of the maximum formatted size (up-front size
+// check, unchecked writers) and compares it with the run time path output.
+template <typename Fmt, typename T>
+static void check_unchecked_output(const Fmt fmt, const T value)
+{
+    constexpr auto size = usf::max_formatted_size<T>(Fmt{});
+
+    std::array<char, size + 4> str{};
+    str.fill('#');
+
+    char reference[256]{};
+    const auto length = usf::format_to(reference, 256, Fmt::view(), value);
+
+    REQUIRE_GT(length, 0);
+    CHECK_LT(length, size);
+    CHECK_EQ(usf::format_to(str.data(), size, fmt, value), length);
+    CHECK_EQ(str.data(), reference);
+    CHECK_EQ(std::string(str.data() + size, 4), "####");
+}
+
+TEST_CASE("usf::format_to, compile-time format string (up-front size check)")
+{
+    for(const auto value : {INT64_MIN, INT64_MIN + 1, int64_t(-1), int64_t(0), INT64_MAX})
+    {
+        check_unchecked_output(USF_FMT("{}"), value);
+        check_unchecked_output(USF_FMT("{:+,d}"), value);
+        check_unchecked_output(USF_FMT("{:#b}"), value);
+        check_unchecked_output(USF_FMT("{:#o}"), value);
+        check_unchecked_output(USF_FMT("{:^#30X}"), value);
+        check_unchecked_output(USF_FMT("{:#030x}"), static_cast<uint64_t>(value));
+        check_unchecked_output(USF_FMT("{:_d}"), static_cast<uint64_t>(value));
+        check_unchecked_output(USF_FMT("{: d}"), static_cast<int16_t>(value));
+        check_unchecked_output(USF_FMT("{:d}"), static_cast<char>(value));
+    }
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    for(int exponent = -22; exponent <= 22; ++exponent)
+    {
+        for(const double significand : {1.0, -1.5, 9.9999999999, -1.8446744, 0.5})
+        {
+            const double value = significand * std::pow(10.0, exponent);
+
+            check_unchecked_output(USF_FMT("{}"), value);
+            check_unchecked_output(USF_FMT("{:#.15g}"), value);
+            check_unchecked_output(USF_FMT("{:,.12f}"), value);
+            check_unchecked_output(USF_FMT("{:f}"), value);
+            check_unchecked_output(USF_FMT("{:+,.3f}"), value);
+            check_unchecked_output(USF_FMT("{:#.0f}"), value);
+            check_unchecked_output(USF_FMT("{:e}"), value);
+            check_unchecked_output(USF_FMT("{:<20.10E}"), value);
+        }
+    }
+#endif
+
+    // Strings without precision are sized at run time: falls back to the
+    // checked writers if the output doesn't fit.
+    char str[16]{};
+    const std::string value("0123456789");
+
+    CHECK_EQ(usf::format_to(str, 16, USF_FMT("[{}]{:>3}"), value, 'c'), 15);
+    CHECK_EQ(str, "[0123456789]  c");
+    CHECK_EQ(usf::format_to(str, 15, USF_FMT("[{}]{:>3}"), value, 'c'), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 16, USF_FMT("{:12}|"), "abc"), 13);
+    CHECK_EQ(str, "abc         |");
+}
+
+// Constant expression string comparison
+static constexpr bool static_equal(const usf::StringView str, const char* expected)
+{
+    for(const char ch : str)
+    {
+        if(ch != *expected++) { return false; }
+    }
+    return *expected == '\0';
+}
+
+template <std::size_t... I>
+static constexpr auto make_register_names(std::index_sequence<I...>)
+{
+    return std::array{usf::static_format(USF_FMT("r{:<2}|{:#04x}"), static_cast<uint8_t>(I), 4 * I)...};
+}
+
+// Compares the usf::static_format() output with the run time path output.
+template <typename Fmt, typename T>
+static void check_static_output(const Fmt fmt, const T value)
+{
+    char reference[256]{};
+    const auto length = usf::format_to(reference, 256, Fmt::view(), value);
+    const auto str = usf::static_format(fmt, value);
+
+    REQUIRE_GT(length, 0);
+    CHECK_EQ(str.size(), length);
+    CHECK_EQ(str.c_str(), reference);
+}
+
+TEST_CASE("usf::static_format")
+{
+    constexpr auto reg = usf::static_format(USF_FMT("reg{:02d}"), 7);
+    static_assert(static_equal(reg.view(), "reg07"), "");
+    CHECK_EQ(reg.c_str(), "reg07");
+
+    constexpr auto banner = usf::static_format(USF_FMT("{:*^11}|{:<4}|{:c}{:d}|{}|{:.3s}"), "usf", true, 'x', 'x', false, "abcdef");
+    static_assert(static_equal(banner.view(), "****usf****|true|x120|false|abc"), "");
+
+    constexpr auto numbers = usf::static_format(USF_FMT("{:+,d} {:#o} {:#010b} {:X} {:_d}"), INT64_MIN, 8U, int8_t(-5), uint16_t(0xbeef), 1234567ULL);
+    static_assert(static_equal(numbers.view(), "-9,223,372,036,854,775,808 010 -0b0000101 BEEF 1_234_567"), "");
+
+    constexpr auto names = make_register_names(std::make_index_sequence<16>{});
+    static_assert(static_equal(names[0].view(), "r0 |0x00"), "");
+    static_assert(static_equal(names[15].view(), "r15|0x3c"), "");
+
+    for(const auto value : {INT64_MIN, int64_t(-1234567), int64_t(-1), int64_t(0), int64_t(42), INT64_MAX})
+    {
+        check_static_output(USF_FMT("{}"), value);
+        check_static_output(USF_FMT("{:+,d}"), value);
+        check_static_output(USF_FMT("{:=+#30b}"), value);
+        check_static_output(USF_FMT("{:^#30o}"), value);
+        check_static_output(USF_FMT("{:#030X}"), static_cast<uint64_t>(value));
+        check_static_output(USF_FMT("{:_}"), static_cast<uint32_t>(value));
+        check_static_output(USF_FMT("{:*< 8d}"), static_cast<int16_t>(value));
+        check_static_output(USF_FMT("{:x}"), static_cast<char>(value));
+#if defined(USF_INT128_SUPPORT)
+        check_static_output(USF_FMT("{:,}"), static_cast<usf::int128_t>(value) * INT64_MAX);
+        check_static_output(USF_FMT("{:#x}"), static_cast<usf::uint128_t>(value) << 32);
+#endif
+    }
+}
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+TEST_CASE("usf::format_to, compile-time format string (template argument)")
+{
+    char str[32]{};
+
+    CHECK_EQ(usf::format_to<"reg{:02d}">(str, 32, 7), 5);
+    CHECK_EQ(str, "reg07");
+
+    const auto res = usf::basic_format_to<"{:x}">(usf::StringSpan(str, 32), 255);
+    CHECK_EQ(res.first, usf::error::success);
+    CHECK_EQ(res.second.size(), 2);
+    CHECK_EQ(str, "ff");
+
+    static_assert(usf::max_formatted_size<"reg{:02d}", uint8_t>() == 7, "");
+
+    constexpr auto reg = usf::static_format<"reg{:02d}">(7);
+    CHECK_EQ(reg.c_str(), "reg07");
+}
+#endif
+
+TEST_CASE("usf::SlotTemplate")
+{
+    char str[64]{};
+
+    auto line = usf::make_slot_template(usf::StringSpan(str, 64), USF_FMT("T:{:5d}C H:{:>4}% [{0:04x}] {:<6}"),
+                                        21, 45U, "idle");
+
+    using Line = decltype(line);
+    static_assert(Line::kSlotCount == 4);
+    static_assert(Line::kSize == 30);
+
+    CHECK_EQ(line.ec_error(), usf::error::success);
+    CHECK_EQ(str, "T:   21C H:  45% [0015] idle  ");
+    CHECK_EQ(line.dirty(), 0xFU);
+    CHECK_EQ(line.slot_offset(1), 11);
+    CHECK_EQ(std::string(line.slot(1).data(), static_cast<std::size_t>(line.slot(1).size())), "  45");
+
+    // Only the slots that changed are dirty
+    line.clear_dirty();
+    CHECK_EQ(line.update<1>(45U), usf::error::success);
+    CHECK_EQ(line.dirty(), 0U);
+
+    CHECK_EQ(line.update<0>(-7), usf::error::success);
+    CHECK_EQ(str, "T:   -7C H:  45% [-007] idle  ");
+    CHECK_EQ(line.dirty(), 0x5U);
+
+    CHECK_EQ(line.update<2>("run"), usf::error::success);
+    CHECK_EQ(str, "T:   -7C H:  45% [-007] run   ");
+    CHECK_EQ(line.dirty(), 0xDU);
+
+    // Values wider than their slot leave it unchanged
+    CHECK_EQ(line.update<1>(12345U), usf::error::buf_overflow);
+    CHECK_EQ(line.update<2>("running"), usf::error::buf_overflow);
+    CHECK_EQ(str, "T:   -7C H:  45% [-007] run   ");
+
+    // Initial values wider than their slot: blank (fill character), the
+    // other slots rendered
+    std::memset(str, '#', sizeof(str));
+    auto wide = usf::make_slot_template(usf::StringSpan(str, 64), USF_FMT("[{:3}|{:*>4}|{:2}]"), 1234, "toolong", 5);
+    CHECK_EQ(wide.ec_error(), usf::error::buf_overflow);
+    CHECK_EQ(str, "[   |****| 5]");
+    CHECK_EQ(wide.dirty(), 0x7U);
+
+    // Output buffer too small
+    char small[8]{};
+    auto short_line = usf::make_slot_template(usf::StringSpan(small, 8), USF_FMT("{:8d}"), 1);
+    CHECK_EQ(short_line.ec_error(), usf::error::buf_overflow);
+    CHECK_EQ(short_line.update<0>(2), usf::error::buf_overflow);
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+    auto row = usf::make_slot_template<"|{:3}|">(usf::StringSpan(str, 64), 7);
+    row.update<0>(42);
+    CHECK_EQ(str, "| 42|");
+#endif
+}
+
+#endif // #if defined(USF_TEST_COMPILE_TIME)
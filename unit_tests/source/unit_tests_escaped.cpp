@@ -0,0 +1,126 @@
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_ESCAPED_STRINGS)
+
+#include <random>
+#include <string>
+
+// Reference escaping, a character at a time
+static std::string escape(const std::string& str)
+{
+    std::string result = "\"";
+
+    for(const char ch : str)
+    {
+        const auto byte = static_cast<unsigned char>(ch);
+
+        switch(ch)
+        {
+            case '"':  result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\b': result += "\\b";  break;
+            case '\f': result += "\\f";  break;
+            case '\n': result += "\\n";  break;
+            case '\r': result += "\\r";  break;
+            case '\t': result += "\\t";  break;
+            default:
+                if(byte < 0x20U || byte == 0x7FU)
+                {
+                    char hex[8]{};
+                    std::snprintf(hex, 8, "\\u%04x", byte);
+                    result += hex;
+                }
+                else
+                {
+                    result += ch;
+                }
+                break;
+        }
+    }
+    return result + "\"";
+}
+
+// ----------------------------------------------------------------------------
+// ESCAPED STRINGS
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, escaped strings")
+{
+    char str[128]{};
+
+    usf::format_to(str, 128, "{:?}", "plain");
+    CHECK_EQ(std::string(str), "\"plain\"");
+
+    usf::format_to(str, 128, "{:?}", "");
+    CHECK_EQ(std::string(str), "\"\"");
+
+    usf::format_to(str, 128, "{:?}", "say \"hi\"\\ok\n\t\r\b\f");
+    CHECK_EQ(std::string(str), "\"say \\\"hi\\\"\\\\ok\\n\\t\\r\\b\\f\"");
+
+    usf::format_to(str, 128, "{:?}", "\x01\x1f\x7f");
+    CHECK_EQ(std::string(str), "\"\\u0001\\u001f\\u007f\"");
+
+    // Embedded null characters and UTF-8 (copied)
+    usf::format_to(str, 128, "{:?}", usf::StringView("a\0b", 3));
+    CHECK_EQ(std::string(str), "\"a\\u0000b\"");
+
+    usf::format_to(str, 128, "{:?}", "\xc3\xa9t\xc3\xa9");
+    CHECK_EQ(std::string(str), "\"\xc3\xa9t\xc3\xa9\"");
+
+    // The width includes the quotes and the escape sequences
+    usf::format_to(str, 128, "[{:10?}]", "a\n");
+    CHECK_EQ(std::string(str), "[\"a\\n\"     ]");
+
+    usf::format_to(str, 128, "[{:*>10?}]", "a\n");
+    CHECK_EQ(std::string(str), "[*****\"a\\n\"]");
+
+    usf::format_to(str, 128, "[{:^9?}]", "\"");
+    CHECK_EQ(std::string(str), "[  \"\\\"\"   ]");
+
+    // The precision limits the characters escaped
+    usf::format_to(str, 128, "{:.3?}", "\n\n\n\n");
+    CHECK_EQ(std::string(str), "\"\\n\\n\\n\"");
+
+    // Compile-time format strings
+    usf::format_to(str, 128, USF_FMT("{:?} {:?}"), "a\tb", usf::StringView("\"c\""));
+    CHECK_EQ(std::string(str), "\"a\\tb\" \"\\\"c\\\"\"");
+
+    CHECK_EQ(usf::max_formatted_size<char[4]>(USF_FMT("{:?}")), 2 + 6 * 3 + 1);
+    CHECK_EQ(usf::max_formatted_size<usf::StringView>(USF_FMT("{:.10?}")), 2 + 6 * 10 + 1);
+
+    // Buffer bounds: the escaped size counts
+    CHECK_EQ(usf::format_to(str, 7, "{:?}", "\n\n"), 6);
+    CHECK_EQ(usf::format_to(str, 6, "{:?}", "\n\n"), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 6, USF_FMT("{:?}"), "\n\n"), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 7, USF_FMT("{:?}"), "\n\n"), 6);
+
+    // Strings only
+    CHECK_EQ(usf::format_to(str, 128, "{:?}", 42), ssize_t(usf::error::arg_type));
+    CHECK_EQ(usf::format_to(str, 128, "{:+?}", "a"), ssize_t(usf::error::inv_sign));
+}
+
+TEST_CASE("usf::format_to, escaped strings (random values)")
+{
+    std::mt19937 rng(1234);
+
+    const char special[] = {'"', '\\', '\n', '\t', '\0', '\x01', '\x1f', '\x7f', '\x20', '\x80', '\xff'};
+
+    char str[1024]{};
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        // Plain runs of any length around the vector widths, a few special characters
+        std::string value(rng() % 80, 'x');
+
+        for(auto& ch : value)
+        {
+            const unsigned r = rng() % 64;
+            ch = (r < sizeof(special)) ? special[r] : static_cast<char>('0' + r);
+        }
+
+        const auto size = usf::format_to(str, 1024, "{:?}", usf::StringView(value));
+        REQUIRE_GT(size, 0);
+        CHECK_EQ(std::string(str, static_cast<std::size_t>(size)), escape(value));
+    }
+}
+
+#endif // defined(USF_TEST_ESCAPED_STRINGS)
@@ -0,0 +1,405 @@
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_INTEGERS)
+
+#include <cinttypes>
+#include <random>
+
+// ----------------------------------------------------------------------------
+// INTEGER CONVERSIONS
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, hexadecimal conversion")
+{
+    char str[64]{};
+
+    usf::format_to(str, 64, "{:x}", 0U);                    CHECK_EQ(str, "0");
+    usf::format_to(str, 64, "{:x}", 0xABCU);                CHECK_EQ(str, "abc");
+    usf::format_to(str, 64, "{:X}", 0xDEADBEEFU);           CHECK_EQ(str, "DEADBEEF");
+    usf::format_to(str, 64, "{:x}", UINT64_C(0x123456789ABCDEF0)); CHECK_EQ(str, "123456789abcdef0");
+    usf::format_to(str, 64, "{:X}", UINT64_MAX);            CHECK_EQ(str, "FFFFFFFFFFFFFFFF");
+
+    usf::format_to(str, 64, "{:016x}", 1000);               CHECK_EQ(str, "00000000000003e8");
+    usf::format_to(str, 64, "{:08X}", 0xBEEFU);             CHECK_EQ(str, "0000BEEF");
+    usf::format_to(str, 64, "{:#010x}", 0xBEEFU);           CHECK_EQ(str, "0x0000beef");
+    usf::format_to(str, 64, "{:08x}", -255);                CHECK_EQ(str, "-00000ff");
+    usf::format_to(str, 64, "{:+08x}", 255);                CHECK_EQ(str, "+00000ff");
+    usf::format_to(str, 64, "{:020x}", UINT64_MAX);         CHECK_EQ(str, "0000ffffffffffffffff");
+    usf::format_to(str, 64, "{:0=24X}", 0xABCU);            CHECK_EQ(str, "000000000000000000000ABC");
+    usf::format_to(str, 64, "{:*>8x}", 0xABCU);             CHECK_EQ(str, "*****abc");
+
+#if defined(USF_TARGET_64_BITS)
+    const void* ptr = reinterpret_cast<const void*>(UINT64_C(0x7FFF12345678));
+    usf::format_to(str, 64, "{}", ptr);                     CHECK_EQ(str, "7fff12345678");
+    usf::format_to(str, 64, "{:#018P}", ptr);               CHECK_EQ(str, "0X00007FFF12345678");
+#endif
+}
+
+TEST_CASE("usf::format_to, hexadecimal conversion (random values)")
+{
+    std::mt19937_64 rng(5678);
+
+    char str[64]{};
+    char expected[64]{};
+    char fmt[16]{};
+
+    for(int n = 0; n < 10000; ++n)
+    {
+        const uint64_t value = rng() >> (rng() % 64);
+        const int width = 1 + static_cast<int>(rng() % 24);
+
+        std::snprintf(expected, 64, "%0*" PRIx64, width, value);
+        std::snprintf(fmt, 16, "{:0%dx}", width);
+        usf::format_to(str, 64, fmt, value);
+        CHECK_EQ(str, expected);
+
+        std::snprintf(expected, 64, "%" PRIX64, value);
+        usf::format_to(str, 64, "{:X}", value);
+        CHECK_EQ(str, expected);
+    }
+}
+
+TEST_CASE("usf::format_to, binary and octal conversion")
+{
+    char str[80]{};
+
+    usf::format_to(str, 80, "{:b}", 0U);                    CHECK_EQ(str, "0");
+    usf::format_to(str, 80, "{:b}", 0xA5U);                 CHECK_EQ(str, "10100101");
+    usf::format_to(str, 80, "{:032b}", 0x80000001U);        CHECK_EQ(str, "10000000000000000000000000000001");
+    usf::format_to(str, 80, "{:032b}", 5U);                 CHECK_EQ(str, "00000000000000000000000000000101");
+    usf::format_to(str, 80, "{:#012B}", 5U);                CHECK_EQ(str, "0B0000000101");
+    usf::format_to(str, 80, "{:b}", UINT64_MAX);
+    CHECK_EQ(str, "1111111111111111111111111111111111111111111111111111111111111111");
+    usf::format_to(str, 80, "{:066b}", UINT64_C(1) << 63U);
+    CHECK_EQ(str, "001000000000000000000000000000000000000000000000000000000000000000");
+
+    usf::format_to(str, 80, "{:o}", 0U);                    CHECK_EQ(str, "0");
+    usf::format_to(str, 80, "{:o}", 8U);                    CHECK_EQ(str, "10");
+    usf::format_to(str, 80, "{:o}", UINT32_MAX);            CHECK_EQ(str, "37777777777");
+    usf::format_to(str, 80, "{:o}", UINT64_MAX);            CHECK_EQ(str, "1777777777777777777777");
+    usf::format_to(str, 80, "{:#06o}", 8U);                 CHECK_EQ(str, "000010");
+    usf::format_to(str, 80, "{:06o}", -8);                  CHECK_EQ(str, "-00010");
+}
+
+TEST_CASE("usf::format_to, binary and octal conversion (random values)")
+{
+    std::mt19937_64 rng(9012);
+
+    char str[80]{};
+    char expected[80]{};
+    char fmt[16]{};
+
+    for(int n = 0; n < 10000; ++n)
+    {
+        const uint64_t value = rng() >> (rng() % 64);
+        const int width = 1 + static_cast<int>(rng() % 70);
+
+        std::snprintf(expected, 80, "%0*" PRIo64, width, value);
+        std::snprintf(fmt, 16, "{:0%do}", width);
+        usf::format_to(str, 80, fmt, value);
+        CHECK_EQ(str, expected);
+
+        // Reference binary conversion
+        char* it = expected + 79;
+        *it = '\0';
+        uint64_t v = value;
+        do { *(--it) = static_cast<char>('0' + (v & 1U)); v >>= 1U; } while(v != 0);
+
+        usf::format_to(str, 80, "{:b}", value);
+        CHECK_EQ(str, it);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// DIGIT GROUPING
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, digit grouping")
+{
+    char str[128]{};
+
+    usf::format_to(str, 128, "{:,}", 0);
+    CHECK_EQ(str, "0");
+
+    usf::format_to(str, 128, "{:,}", 999);
+    CHECK_EQ(str, "999");
+
+    usf::format_to(str, 128, "{:,}", 1000);
+    CHECK_EQ(str, "1,000");
+
+    usf::format_to(str, 128, "{:,d}", -1234567);
+    CHECK_EQ(str, "-1,234,567");
+
+    usf::format_to(str, 128, "{:_}", UINT64_MAX);
+    CHECK_EQ(str, "18_446_744_073_709_551_615");
+
+    usf::format_to(str, 128, "[{:>12,}]", 1234567);
+    CHECK_EQ(str, "[   1,234,567]");
+
+    usf::format_to(str, 128, "[{:*<+12,d}]", 1234567);
+    CHECK_EQ(str, "[+1,234,567**]");
+
+    usf::format_to(str, 128, "[{:^11,}]", 1234567);
+    CHECK_EQ(str, "[ 1,234,567 ]");
+
+#if defined(USF_INT128_SUPPORT)
+    usf::format_to(str, 128, "{:,}", ~usf::uint128_t{0});
+    CHECK_EQ(str, "340,282,366,920,938,463,463,374,607,431,768,211,455");
+
+    usf::format_to(str, 128, "{:_}", static_cast<usf::uint128_t>(1000000000000000000U) * 1000000000000000000U);
+    CHECK_EQ(str, "1_000_000_000_000_000_000_000_000_000_000_000_000");
+#endif
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    usf::format_to(str, 128, "{:,.2f}", 1234567.891);
+    CHECK_EQ(str, "1,234,567.89");
+
+    usf::format_to(str, 128, "{:_.1f}", -1000.0);
+    CHECK_EQ(str, "-1_000.0");
+
+    usf::format_to(str, 128, "{:,.0f}", 123.0);
+    CHECK_EQ(str, "123");
+
+    usf::format_to(str, 128, "{:,.3f}", 0.5);
+    CHECK_EQ(str, "0.500");
+
+    usf::format_to(str, 128, "[{:>14,.1f}]", 12345.25);
+    CHECK_EQ(str, "[      12,345.2]");
+#endif
+
+    CHECK_EQ(usf::format_to(str, 128, "{:,x}", 1000), ssize_t(usf::error::inv_format));
+    CHECK_EQ(usf::format_to(str, 128, "{:,s}", "1000"), ssize_t(usf::error::inv_format));
+    CHECK_EQ(usf::format_to(str, 128, "{:,}", "1000"), ssize_t(usf::error::inv_format));
+    CHECK_EQ(usf::format_to(str, 8,   "{:,}", 1234567), ssize_t(usf::error::buf_overflow));
+
+    // The zero padding digits aren't grouped
+    CHECK_EQ(usf::format_to(str, 128, "{:012,d}", 1234567), ssize_t(usf::error::inv_format));
+    CHECK_EQ(usf::format_to(str, 128, "{:0=12,}", 1234567), ssize_t(usf::error::inv_format));
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    // Fixed point format only
+    CHECK_EQ(usf::format_to(str, 128, "{:,e}", 1234567.0), ssize_t(usf::error::inv_format));
+    CHECK_EQ(usf::format_to(str, 128, "{:,G}", 1234567.0), ssize_t(usf::error::inv_format));
+    CHECK_EQ(usf::format_to(str, 128, "{:,}", 1234567.0), ssize_t(usf::error::inv_format));
+    CHECK_EQ(usf::format_to(str, 128, USF_FMT("{:,.1f}"), 1234567.0), 11);
+#endif
+}
+
+TEST_CASE("usf::format_to, digit grouping (random values)")
+{
+    std::mt19937_64 rng(32);
+
+    char str[64]{};
+    char digits[32]{};
+    char expected[64]{};
+
+    for(int n = 0; n < 10000; ++n)
+    {
+        const uint64_t value = rng() >> (rng() % 64U);
+
+        // Reference: insert the separators in the printf() output
+        const int count = std::snprintf(digits, 32, "%" PRIu64, value);
+        char* it = expected;
+        for(int i = 0; i < count; ++i)
+        {
+            if(i != 0 && (count - i) % 3 == 0) { *it++ = ','; }
+            *it++ = digits[i];
+        }
+        *it = '\0';
+
+        usf::format_to(str, 64, "{:,}", value);
+        CHECK_EQ(str, expected);
+    }
+}
+
+#if defined(USF_INT128_SUPPORT)
+// ----------------------------------------------------------------------------
+// 128 BIT INTEGERS
+// ----------------------------------------------------------------------------
+static usf::uint128_t make_uint128(const uint64_t high, const uint64_t low)
+{
+    return (static_cast<usf::uint128_t>(high) << 64U) | low;
+}
+
+// Reference conversion, one digit at a time
+static void to_string(char* str, usf::uint128_t value, const unsigned base)
+{
+    char digits[130]{};
+    int n = 0;
+    do
+    {
+        digits[n++] = "0123456789abcdef"[static_cast<unsigned>(value % base)];
+        value /= base;
+    }while(value != 0);
+
+    while(n > 0) { *str++ = digits[--n]; }
+    *str = '\0';
+}
+
+TEST_CASE("usf::format_to, 128 bit integers")
+{
+    char str[160]{};
+
+    const usf::uint128_t umax = ~usf::uint128_t{0};
+    const usf::int128_t  imax = static_cast<usf::int128_t>(umax >> 1U);
+    const usf::int128_t  imin = -imax - 1;
+
+    usf::format_to(str, 160, "{}", umax);
+    CHECK_EQ(str, "340282366920938463463374607431768211455");
+
+    usf::format_to(str, 160, "{}", imax);
+    CHECK_EQ(str, "170141183460469231731687303715884105727");
+
+    usf::format_to(str, 160, "{}", imin);
+    CHECK_EQ(str, "-170141183460469231731687303715884105728");
+
+    usf::format_to(str, 160, "{}", make_uint128(0, 42));
+    CHECK_EQ(str, "42");
+
+    usf::format_to(str, 160, "{}", static_cast<usf::int128_t>(-42));
+    CHECK_EQ(str, "-42");
+
+    // 10^19 and 10^38 boundaries (zero filled chunks)
+    usf::format_to(str, 160, "{}", make_uint128(0, 10000000000000000000U) * 10U);
+    CHECK_EQ(str, "100000000000000000000");
+
+    usf::format_to(str, 160, "{}", make_uint128(0x4B3B4CA85A86C47AU, 0x098A224000000000U));
+    CHECK_EQ(str, "100000000000000000000000000000000000000");
+
+    usf::format_to(str, 160, "{:x}", umax);
+    CHECK_EQ(str, "ffffffffffffffffffffffffffffffff");
+
+    usf::format_to(str, 160, "{:#X}", make_uint128(1, 0));
+    CHECK_EQ(str, "0X10000000000000000");
+
+    usf::format_to(str, 160, "{:040x}", make_uint128(0xABC, 1));
+    CHECK_EQ(str, "000000000000000000000abc0000000000000001");
+
+    usf::format_to(str, 160, "{:o}", umax);
+    CHECK_EQ(str, "3777777777777777777777777777777777777777777");
+
+    usf::format_to(str, 160, "{:b}", make_uint128(5, 3));
+    CHECK_EQ(str, "1010000000000000000000000000000000000000000000000000000000000000011");
+
+    usf::format_to(str, 160, "{:>42}", imin);
+    CHECK_EQ(str, "  -170141183460469231731687303715884105728");
+
+    usf::format_to(str, 160, "{:+050d}", imax);
+    CHECK_EQ(str, "+0000000000170141183460469231731687303715884105727");
+}
+
+TEST_CASE("usf::format_to, 128 bit integers (random values)")
+{
+    std::mt19937_64 rng(31);
+
+    char str[160]{};
+    char expected[160]{};
+
+    for(int n = 0; n < 10000; ++n)
+    {
+        // Random bit lengths to cover every digit count
+        const auto shift = static_cast<unsigned>(rng() % 128U);
+        const usf::uint128_t value = make_uint128(rng(), rng()) >> shift;
+
+        to_string(expected, value, 10);
+        usf::format_to(str, 160, "{}", value);
+        CHECK_EQ(str, expected);
+
+        to_string(expected, value, 16);
+        usf::format_to(str, 160, "{:x}", value);
+        CHECK_EQ(str, expected);
+
+        to_string(expected, value, 8);
+        usf::format_to(str, 160, "{:o}", value);
+        CHECK_EQ(str, expected);
+
+        to_string(expected, value, 2);
+        usf::format_to(str, 160, "{:b}", value);
+        CHECK_EQ(str, expected);
+    }
+}
+#endif // defined(USF_INT128_SUPPORT)
+
+// ----------------------------------------------------------------------------
+// INTEGER PARSING
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::parse")
+{
+    auto [err, value, rest] = usf::parse<int>("12345 tail");
+    CHECK_EQ(err, usf::error::success);
+    CHECK_EQ(value, 12345);
+    CHECK_EQ(std::string(rest.cbegin(), rest.cend()), " tail");
+
+    CHECK_EQ(usf::parse<int>("-42").value, -42);
+    CHECK_EQ(usf::parse<int>("0").value, 0);
+    CHECK_EQ(usf::parse<int>("-0").value, 0);
+    CHECK_EQ(usf::parse<uint32_t>("00000000000000000000000000001").value, 1U);
+    CHECK_EQ(usf::parse<uint64_t>("12345678901234567890").value, UINT64_C(12345678901234567890));
+    CHECK_EQ(usf::parse<uint64_t>("18446744073709551615").value, UINT64_MAX);
+    CHECK_EQ(usf::parse<int64_t>("-9223372036854775808").value, INT64_MIN);
+    CHECK_EQ(usf::parse<int64_t>("9223372036854775807").value, INT64_MAX);
+    CHECK_EQ(usf::parse<int8_t>("-128").value, -128);
+    CHECK_EQ(usf::parse<uint8_t>("255").value, 255);
+
+    // Other bases, without prefix
+    CHECK_EQ(usf::parse<uint32_t>("deadBEEF", 16).value, 0xDEADBEEFU);
+    CHECK_EQ(usf::parse<uint64_t>("ffffffffffffffff", 16).value, UINT64_MAX);
+    CHECK_EQ(usf::parse<int>("-7f", 16).value, -127);
+    CHECK_EQ(usf::parse<uint32_t>("777", 8).value, 0777U);
+    CHECK_EQ(usf::parse<uint32_t>("1011", 2).value, 11U);
+    CHECK_EQ(usf::parse<uint32_t>("0x10", 16).value, 0U);
+
+    const auto bin = usf::parse<uint32_t>("1012", 2);
+    CHECK_EQ(bin.value, 5U);
+    CHECK_EQ(bin.rest.size(), 1);
+
+    // The digits are consumed on overflow
+    const auto overflow = usf::parse<uint64_t>("18446744073709551616;");
+    CHECK_EQ(overflow.ec, usf::error::value_overflow);
+    CHECK_EQ(std::string(overflow.rest.cbegin(), overflow.rest.cend()), ";");
+
+    CHECK_EQ(usf::parse<int8_t>("128").ec, usf::error::value_overflow);
+    CHECK_EQ(usf::parse<int8_t>("-129").ec, usf::error::value_overflow);
+    CHECK_EQ(usf::parse<uint16_t>("65536").ec, usf::error::value_overflow);
+    CHECK_EQ(usf::parse<int64_t>("9223372036854775808").ec, usf::error::value_overflow);
+    CHECK_EQ(usf::parse<uint64_t>("10000000000000000", 16).ec, usf::error::value_overflow);
+    CHECK_EQ(usf::parse<uint64_t>("123456789012345678901234567890").ec, usf::error::value_overflow);
+
+    // Errors: nothing consumed
+    for(const char* str : {"", "-", "+1", " 1", "x"})
+    {
+        const auto result = usf::parse<int>(str);
+        CHECK_EQ(result.ec, usf::error::inv_format);
+        CHECK_EQ(result.rest.cbegin(), str);
+    }
+    CHECK_EQ(usf::parse<unsigned>("-1").ec, usf::error::inv_format);
+    CHECK_EQ(usf::parse<int>("1", 7).ec, usf::error::inv_type);
+}
+
+TEST_CASE("usf::parse (random values)")
+{
+    std::mt19937_64 rng(4321);
+    char str[80]{};
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        // Random digit counts, to cover the 8 digits at a time paths
+        const uint64_t value = rng() >> (rng() % 64U);
+        const int64_t  svalue = static_cast<int64_t>(rng()) >> (rng() % 64U);
+
+        usf::format_to(str, 80, "{}", value);
+        CHECK_EQ(usf::parse<uint64_t>(str).value, value);
+
+        usf::format_to(str, 80, "{:x}", value);
+        CHECK_EQ(usf::parse<uint64_t>(str, 16).value, value);
+
+        usf::format_to(str, 80, "{:o}", value);
+        CHECK_EQ(usf::parse<uint64_t>(str, 8).value, value);
+
+        usf::format_to(str, 80, "{:b}", value);
+        CHECK_EQ(usf::parse<uint64_t>(str, 2).value, value);
+
+        usf::format_to(str, 80, "{}", svalue);
+        CHECK_EQ(usf::parse<int64_t>(str).value, svalue);
+    }
+}
+
+#endif // #if defined(USF_TEST_INTEGERS)
@@ -0,0 +1,217 @@
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_JSON)
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+static std::string to_string(const usf::result_t& result)
+{
+    return std::string(result.second.cbegin(), result.second.cend());
+}
+
+// ----------------------------------------------------------------------------
+// JSON WRITER
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::JsonWriter")
+{
+    char str[256]{};
+
+    SUBCASE("objects and arrays")
+    {
+        usf::JsonWriter json(usf::StringSpan(str, 256));
+
+        json.begin_object()
+                .member("time", 1234).member("level", "warn")
+                .key("tags").begin_array().value(1).value(2.5).end_array()
+                .key("empty").begin_object().end_object()
+                .key("nested").begin_array().begin_array().end_array().begin_object().member("a", nullptr).end_object().end_array()
+            .end_object();
+
+        const auto result = json.finish();
+        CHECK_EQ(result.first, usf::error::success);
+        CHECK_EQ(to_string(result), R"({"time":1234,"level":"warn","tags":[1,2.5],"empty":{},"nested":[[],{"a":null}]})");
+        CHECK_EQ(json.size(), result.second.size());
+
+        // Null terminated
+        CHECK_EQ(std::string(str), to_string(result));
+    }
+
+    SUBCASE("values")
+    {
+        usf::JsonWriter json(usf::StringSpan(str, 256));
+
+        json.begin_array()
+                .value(true).value(false).value(nullptr).value('c')
+                .value(int8_t(INT8_MIN)).value(uint16_t(UINT16_MAX)).value(0)
+                .value(INT64_MIN).value(UINT64_MAX)
+                .value(usf::StringView("a\"b\\\n\x01"))
+                .raw(R"({"cached":[1,2]})")
+            .end_array();
+
+        CHECK_EQ(to_string(json.finish()),
+                 R"([true,false,null,"c",-128,65535,0,-9223372036854775808,18446744073709551615,"a\"b\\\n\u0001",{"cached":[1,2]}])");
+
+        // Top level scalars
+        usf::JsonWriter scalar(usf::StringSpan(str, 256));
+        CHECK_EQ(to_string(scalar.value(-42).finish()), "-42");
+
+        // Member names are escaped too
+        usf::JsonWriter escaped(usf::StringSpan(str, 256));
+        CHECK_EQ(to_string(escaped.begin_object().member("a\tb", 1).end_object().finish()), R"({"a\tb":1})");
+    }
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    SUBCASE("floating point")
+    {
+        usf::JsonWriter json(usf::StringSpan(str, 256));
+
+        json.begin_array()
+                .value(0.0).value(-0.0).value(1.0).value(-2.5).value(0.1).value(100.0)
+                .value(1234567.0).value(0.0001).value(0.00001234).value(3.14159265358979, 15)
+                .value(1234567.0, 6).value(0.1 + 0.2)
+                .value(std::numeric_limits<double>::quiet_NaN()).value(-std::numeric_limits<double>::infinity())
+            .end_array();
+
+        CHECK_EQ(to_string(json.finish()),
+                 "[0,-0,1,-2.5,0.1,100,1234567,0.0001,1.234e-05,3.14159265358979,1.23457e+06,0.3,null,null]");
+
+        // Out of the converter range
+        usf::JsonWriter range(usf::StringSpan(str, 256));
+
+        range.begin_array()
+                .value(1e20).value(-2.5e-20).value(1e-300, 6).value(std::numeric_limits<double>::max(), 6)
+                .value(std::numeric_limits<double>::denorm_min(), 3)
+            .end_array();
+
+        CHECK_EQ(to_string(range.finish()), "[1e+20,-2.5e-20,1e-300,1.79769e+308,4.94e-324]");
+
+        usf::JsonWriter precision(usf::StringSpan(str, 256));
+        CHECK_EQ(precision.value(1.0, 0).finish().first, usf::error::arg_precision);
+    }
+#endif
+
+    SUBCASE("errors")
+    {
+        // Value without a key in an object, key in an array
+        usf::JsonWriter no_key(usf::StringSpan(str, 256));
+        CHECK_EQ(no_key.begin_object().value(1).end_object().finish().first, usf::error::inv_format);
+
+        usf::JsonWriter array_key(usf::StringSpan(str, 256));
+        CHECK_EQ(array_key.begin_array().key("a").finish().first, usf::error::inv_format);
+
+        // Key without a value, mismatched and unbalanced ends
+        usf::JsonWriter no_value(usf::StringSpan(str, 256));
+        CHECK_EQ(no_value.begin_object().key("a").end_object().finish().first, usf::error::inv_format);
+
+        usf::JsonWriter mismatch(usf::StringSpan(str, 256));
+        CHECK_EQ(mismatch.begin_object().end_array().finish().first, usf::error::inv_format);
+
+        usf::JsonWriter open(usf::StringSpan(str, 256));
+        CHECK_EQ(open.begin_array().value(1).finish().first, usf::error::inv_format);
+
+        usf::JsonWriter closed(usf::StringSpan(str, 256));
+        CHECK_EQ(closed.end_object().finish().first, usf::error::inv_format);
+
+        // Nothing written, two top level values
+        usf::JsonWriter empty(usf::StringSpan(str, 256));
+        CHECK_EQ(empty.finish().first, usf::error::inv_format);
+
+        usf::JsonWriter two(usf::StringSpan(str, 256));
+        CHECK_EQ(two.value(1).value(2).finish().first, usf::error::inv_format);
+
+        // Nesting deeper than the stack
+        usf::JsonWriter deep(usf::StringSpan(str, 256));
+        for(int n = 0; n < usf::JsonWriter::kMaxDepth; ++n) { deep.begin_array(); }
+        CHECK_EQ(deep.ec_error(), usf::error::success);
+        deep.begin_array();
+        CHECK_EQ(deep.ec_error(), usf::error::buf_overflow);
+
+        // The first error is kept
+        usf::JsonWriter sticky(usf::StringSpan(str, 256));
+        sticky.begin_array().end_object().value(usf::StringView("ignored")).end_array();
+        CHECK_EQ(sticky.ec_error(), usf::error::inv_format);
+        CHECK_EQ(sticky.size(), 1);
+    }
+
+    SUBCASE("buffer bounds")
+    {
+        // {"key":"a\n"} is 13 characters, plus the null terminator
+        for(int size = 0; size <= 14; ++size)
+        {
+            usf::JsonWriter json(usf::StringSpan(str, size));
+            const auto result = json.begin_object().member("key", "a\n").end_object().finish();
+
+            if(size < 14) {
+                CHECK_EQ(result.first, usf::error::buf_overflow);
+            } else {
+                CHECK_EQ(to_string(result), R"({"key":"a\n"})");
+            }
+            CHECK_LE(json.size(), size);
+        }
+    }
+
+    SUBCASE("sink records")
+    {
+        char storage[1024]{};
+        usf::MpscSink sink(usf::StringSpan(storage, 1024));
+
+        auto [err, record] = sink.reserve(64);
+        REQUIRE_EQ(err, usf::error::success);
+
+        usf::JsonWriter json(record.span);
+        json.begin_object().member("id", 7).end_object();
+        sink.commit(record, json.size());
+
+        std::string consumed;
+        sink.poll([&](const usf::StringView text) { consumed.append(text.cbegin(), text.cend()); });
+        CHECK_EQ(consumed, R"({"id":7})");
+    }
+}
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+TEST_CASE("usf::JsonWriter, floating point (random values)")
+{
+    std::mt19937_64 rng(1234);
+    std::uniform_real_distribution<double> exponent(-18.0, 18.0);
+
+    char str[64]{};
+    char fmt[16]{};
+    char expected[64]{};
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        const double value = ((rng() & 1U) ? -1.0 : 1.0) * std::pow(10.0, exponent(rng));
+        const int precision = 1 + static_cast<int>(rng() % 15);
+
+        // Same output as the general format
+        usf::format_to(fmt, 16, "{{:.{}g}}", precision);
+        usf::format_to(expected, 64, fmt, value);
+
+        usf::JsonWriter json(usf::StringSpan(str, 64));
+        CHECK_EQ(to_string(json.value(value, precision).finish()), std::string(expected));
+    }
+
+    // Out of the converter range: the value read back within the precision
+    // (plus the scaling rounding error)
+    std::uniform_real_distribution<double> wide_exponent(19.5, 307.0);
+
+    for(int i = 0; i < 20000; ++i)
+    {
+        const double magnitude = std::pow(10.0, wide_exponent(rng));
+        const double value = ((rng() & 1U) ? -1.0 : 1.0) * ((rng() & 2U) ? magnitude : 1.0 / magnitude);
+        const int precision = 1 + static_cast<int>(rng() % 15);
+
+        usf::JsonWriter json(usf::StringSpan(str, 64));
+        const auto result = json.value(value, precision).finish();
+        REQUIRE_EQ(result.first, usf::error::success);
+
+        const double read = std::strtod(str, nullptr);
+        CHECK_LE(std::fabs(read - value), std::fabs(value) * (0.5 * std::pow(10.0, 1 - precision) + 1e-14));
+    }
+}
+#endif
+
+#endif // defined(USF_TEST_JSON)
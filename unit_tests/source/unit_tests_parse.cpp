@@ -0,0 +1,123 @@
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_PARSE) && !defined(USF_DISABLE_FLOAT_SUPPORT)
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+// ----------------------------------------------------------------------------
+// FLOATING POINT PARSING
+// ----------------------------------------------------------------------------
+template <typename T>
+static bool same_bits(const T a, const T b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+TEST_CASE("usf::parse, floating point")
+{
+    auto [err, value, rest] = usf::parse<double>("-1.25e-3,next");
+    CHECK_EQ(err, usf::error::success);
+    CHECK_UNARY(same_bits(value, -1.25e-3));
+    CHECK_EQ(std::string(rest.cbegin(), rest.cend()), ",next");
+
+    CHECK_UNARY(same_bits(usf::parse<double>("0").value, 0.0));
+    CHECK(same_bits(usf::parse<double>("-0.0").value, -0.0));
+    CHECK_UNARY(same_bits(usf::parse<double>("42").value, 42.0));
+    CHECK_UNARY(same_bits(usf::parse<double>("3.").value, 3.0));
+    CHECK_UNARY(same_bits(usf::parse<double>(".5").value, 0.5));
+    CHECK_UNARY(same_bits(usf::parse<double>("0.1").value, 0.1));
+    CHECK_UNARY(same_bits(usf::parse<double>("1E+10").value, 1e10));
+    CHECK_UNARY(same_bits(usf::parse<double>("000123.456000e-2").value, 1.23456));
+    CHECK_UNARY(same_bits(usf::parse<double>("1e23").value, 1e23));
+    CHECK_UNARY(same_bits(usf::parse<double>("9007199254740993").value, 9007199254740992.0));
+    CHECK_UNARY(same_bits(usf::parse<double>("1.7976931348623157e308").value, std::numeric_limits<double>::max()));
+    CHECK_UNARY(same_bits(usf::parse<double>("2.2250738585072014e-308").value, std::numeric_limits<double>::min()));
+    CHECK_UNARY(same_bits(usf::parse<double>("4.9406564584124654e-324").value, std::numeric_limits<double>::denorm_min()));
+    CHECK_UNARY(same_bits(usf::parse<float>("3.4028235e38").value, std::numeric_limits<float>::max()));
+    CHECK_UNARY(same_bits(usf::parse<float>("1.4e-45").value, std::numeric_limits<float>::denorm_min()));
+    CHECK_UNARY(same_bits(usf::parse<float>("0.1").value, 0.1f));
+
+    // Halfway cases decided by the digits past the 19th
+    CHECK_UNARY(same_bits(usf::parse<double>("1.00000000000000011102230246251565404236316680908203125").value, 1.0));
+    CHECK_UNARY(same_bits(usf::parse<double>("1.000000000000000111022302462515654042363166809082031250001").value, 1.0000000000000002));
+    CHECK_UNARY(same_bits(usf::parse<double>("9007199254740993.0000000000000000000000000000001").value, 9007199254740994.0));
+
+    // Infinity and NaN
+    CHECK_UNARY(same_bits(usf::parse<double>("inf").value, std::numeric_limits<double>::infinity()));
+    CHECK_UNARY(same_bits(usf::parse<double>("-Infinity").value, -std::numeric_limits<double>::infinity()));
+    CHECK(std::isnan(usf::parse<float>("NaN").value));
+
+    // The exponent is only consumed if followed by digits
+    const auto exponent = usf::parse<double>("2e+x");
+    CHECK_UNARY(same_bits(exponent.value, 2.0));
+    CHECK_EQ(std::string(exponent.rest.cbegin(), exponent.rest.cend()), "e+x");
+
+    // Out of range, the number is consumed
+    const auto overflow = usf::parse<double>("1e309 ");
+    CHECK_EQ(overflow.ec, usf::error::value_overflow);
+    CHECK_EQ(overflow.rest.size(), 1);
+    CHECK_EQ(usf::parse<double>("2e-324").ec, usf::error::value_overflow);
+    CHECK_EQ(usf::parse<float>("3.5e38").ec, usf::error::value_overflow);
+    CHECK_UNARY(same_bits(usf::parse<double>("0e999999").value, 0.0));
+
+    // Errors: nothing consumed
+    for(const char* str : {"", "-", ".", "+1", " 1", "e5", "in", "x"})
+    {
+        const auto result = usf::parse<double>(str);
+        CHECK_EQ(result.ec, usf::error::inv_format);
+        CHECK_EQ(result.rest.cbegin(), str);
+    }
+    CHECK_EQ(usf::parse<double>("1", 16).ec, usf::error::inv_type);
+}
+
+TEST_CASE("usf::parse, floating point round trip")
+{
+    std::mt19937_64 rng(8765);
+
+    char str[64]{};
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        // Random bit patterns cover all the exponents and subnormals
+        const uint64_t bits = rng();
+        double value = 0;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if(!std::isfinite(value) || std::fpclassify(value) == FP_ZERO) { continue; }
+
+        // Shortest exact representation: same value back
+        std::snprintf(str, 64, "%.17g", value);
+        CHECK_UNARY(same_bits(usf::parse<double>(str).value, value));
+
+        const auto single = static_cast<float>(value);
+        if(std::isfinite(single) && std::fpclassify(single) != FP_ZERO)
+        {
+            std::snprintf(str, 64, "%.9g", static_cast<double>(single));
+            CHECK_UNARY(same_bits(usf::parse<float>(str).value, single));
+        }
+    }
+
+    // Formatter output: correctly rounded as strtod() does. Values in the
+    // formatter range ([1e-19, 1.8e19]), no nested precision: fixed specs.
+    const char* const specs[] = {"{:e}", "{:.0e}", "{:.14e}", "{:g}", "{:.12G}", "{:f}", "{:.3f}"};
+
+    std::uniform_real_distribution<double> exponent(-18.9, 19.2);
+
+    for(int i = 0; i < 100000; ++i)
+    {
+        const double value = ((rng() & 1U) ? -1.0 : 1.0) * std::pow(10.0, exponent(rng));
+        const char* const spec = specs[rng() % (sizeof(specs) / sizeof(specs[0]))];
+
+        const auto formatted = usf::format_to(str, 64, spec, value);
+        REQUIRE_GT(formatted, 0);
+
+        const auto parsed = usf::parse<double>(str);
+        REQUIRE_EQ(parsed.ec, usf::error::success);
+        CHECK_EQ(parsed.rest.size(), 0);
+        CHECK_UNARY(same_bits(parsed.value, std::strtod(str, nullptr)));
+    }
+}
+
+#endif // defined(USF_TEST_PARSE) && !defined(USF_DISABLE_FLOAT_SUPPORT)
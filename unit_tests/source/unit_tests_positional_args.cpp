@@ -26,4 +26,192 @@ TEST_CASE("usf::format_to, positional indices")
     CHECK_EQ(str, "abracadabra");
 }
 
+TEST_CASE("usf::format_to, positional index out of range")
+{
+    char str[32]{};
+
+    CHECK_EQ(usf::format_to(str, 32, "{1}", "abra", "cad"), 3);
+    CHECK_EQ(usf::format_to(str, 32, "{2}", "abra", "cad"), ssize_t(usf::error::arg_index_too_large));
+    CHECK_EQ(usf::format_to(str, 32, "{300}", "abra"), ssize_t(usf::error::arg_index_too_large));
+}
+
+template <std::size_t... I>
+ssize_t format_wide(char* str, const std::ptrdiff_t str_count, usf::StringView fmt, std::index_sequence<I...>)
+{
+    return usf::format_to(str, str_count, fmt, static_cast<int>(I)...);
+}
+
+TEST_CASE("usf::format_to, wide records")
+{
+    char str[512]{};
+
+    // 64 sequential arguments
+    std::string fmt;
+    std::string expected;
+    for(int n = 0; n < 64; ++n)
+    {
+        fmt += "{},";
+        expected += std::to_string(n) + ",";
+    }
+
+    CHECK_EQ(format_wide(str, 512, fmt, std::make_index_sequence<64>{}), ssize_t(expected.size()));
+    CHECK_EQ(std::string(str), expected);
+
+    // Up to 255 arguments
+    CHECK_EQ(format_wide(str, 512, "{254}|{128}|{0}", std::make_index_sequence<255>{}), 9);
+    CHECK_EQ(str, "254|128|0");
+    CHECK_EQ(format_wide(str, 512, "{255}", std::make_index_sequence<255>{}), ssize_t(usf::error::arg_index_too_large));
+}
+
+// ----------------------------------------------------------------------------
+// REPEATED FIELDS
+// ----------------------------------------------------------------------------
+struct Counted
+{
+    int value;
+};
+
+static int counted_conversions = 0;
+
+namespace usf
+{
+template <>
+struct Formatter<Counted>
+{
+    static result_t format_to(StringSpan dst, const Counted& counted)
+    {
+        ++counted_conversions;
+        return basic_format_to(dst, "<{}>", counted.value);
+    }
+};
+} // namespace usf
+
+TEST_CASE("usf::format_to, repeated fields")
+{
+    char str[64]{};
+
+    usf::format_to(str, 64, "{0}-{1:x}-{0}-{0:>4}-{1:x}", 42, 255);
+    CHECK_EQ(str, "42-ff-42-  42-ff");
+
+    // The repeated fields are copied, not converted again
+    counted_conversions = 0;
+    CHECK_EQ(usf::format_to(str, 64, "{0} {1} {0} {0} {id}", Counted{7}, 1, usf::arg("id", Counted{7})), 17);
+    CHECK_EQ(str, "<7> 1 <7> <7> <7>");
+    CHECK_EQ(counted_conversions, 2);
+
+    counted_conversions = 0;
+    usf::format_to(str, 64, USF_FMT("{0} {1} {0} {0}"), Counted{7}, 1);
+    CHECK_EQ(str, "<7> 1 <7> <7>");
+    CHECK_EQ(counted_conversions, 1);
+
+    // Output buffer overflow at a repeated field
+    CHECK_EQ(usf::format_to(str, 8, "{0}|{0}", "abc"), 7);
+    CHECK_EQ(usf::format_to(str, 7, "{0}|{0}", "abc"), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 7, USF_FMT("{0}|{0}"), "abc"), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to(str, 8, USF_FMT("{0}|{0}"), "abc"), 7);
+    CHECK_EQ(str, "abc|abc");
+
+    // Fields of the same argument and format spec are resolved at compile time
+    auto fmt = USF_FMT("{0}{1}{0:x}{0}{}{0:x}");
+    using Compiled = usf::internal::CompiledFormat<decltype(fmt), int, int>;
+    static_assert(Compiled::kProgram.segments[2].repeat == -1);
+    static_assert(Compiled::kProgram.segments[3].repeat == 0);
+    static_assert(Compiled::kProgram.segments[4].repeat == 0);
+    static_assert(Compiled::kProgram.segments[5].repeat == 2);
+    static_assert(Compiled::kRepeated[0] && !Compiled::kRepeated[1] && Compiled::kRepeated[2]);
+}
+
+// ----------------------------------------------------------------------------
+// NAMED ARGUMENTS
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, named arguments")
+{
+    char str[32]{};
+
+    const char* host = "localhost";
+    const int   port = 8080;
+
+    CHECK_EQ(usf::format_to(str, 32, "{host}:{port}", usf::arg("host", host), usf::arg("port", port)), 14);
+    CHECK_EQ(str, "localhost:8080");
+
+    usf::format_to(str, 32, "{port:>6}|{host:.5s}", usf::arg("host", host), usf::arg("port", port));
+    CHECK_EQ(str, "  8080|local");
+
+    usf::format_to(str, 32, "{_x1}{_x1:#x}", usf::arg("_x1", 255));
+    CHECK_EQ(str, "2550xff");
+
+    // Named, positional and sequential arguments together
+    usf::format_to(str, 32, "{}-{1}-{name}", 'a', usf::arg("name", "b"));
+    CHECK_EQ(str, "a-b-b");
+
+    // Unknown names
+    CHECK_EQ(usf::format_to(str, 32, "{hots}", usf::arg("host", host)), ssize_t(usf::error::arg_name));
+    CHECK_EQ(usf::format_to(str, 32, "{host}", host), ssize_t(usf::error::arg_name));
+    CHECK_EQ(usf::format_to(str, 32, "{host-}", usf::arg("host", host)), ssize_t(usf::error::arg_enclose));
+}
+
+TEST_CASE("usf::format_to, compile-time named arguments")
+{
+    char str[32]{};
+
+    const int port = 80;
+
+    CHECK_EQ(usf::format_to(str, 32, USF_FMT("{host}:{port:<4}|"),
+                            usf::arg(USF_FMT("host"), "example"), usf::arg(USF_FMT("port"), port)), 13);
+    CHECK_EQ(str, "example:80  |");
+
+    // Runtime format strings take the compile-time names too
+    usf::format_to(str, 32, "{port:x}", usf::arg(USF_FMT("port"), port));
+    CHECK_EQ(str, "50");
+
+    // The names are resolved to argument indices at compile time
+    auto fmt_ba = USF_FMT("{b}{a}");
+    auto fmt_c  = USF_FMT("{c}");
+    auto name_a = USF_FMT("a");
+    auto name_b = USF_FMT("b");
+
+    using NamedA = usf::StaticNamedArg<decltype(name_a), int>;
+    using NamedB = usf::StaticNamedArg<decltype(name_b), int>;
+
+    using Compiled = usf::internal::CompiledFormat<decltype(fmt_ba), NamedA, NamedB>;
+    static_assert(Compiled::kFormatError == usf::error::success);
+    static_assert(Compiled::kProgram.segments[0].index == 1);
+    static_assert(Compiled::kProgram.segments[1].index == 0);
+
+    static_assert(usf::internal::CompiledFormat<decltype(fmt_c), NamedA>::kFormatError == usf::error::arg_name);
+
+    // Run time names can't be resolved at compile time
+    static_assert(usf::internal::CompiledFormat<decltype(fmt_ba), usf::NamedArg<int>, usf::NamedArg<int>>::kFormatError
+                  == usf::error::arg_name);
+
+    constexpr auto name = usf::static_format(USF_FMT("r{n:02d}"), usf::arg(USF_FMT("n"), 7));
+    static_assert(name.size() == 3);
+    CHECK_EQ(name.c_str(), "r07");
+
+    static_assert(usf::max_formatted_size<usf::StaticNamedArg<decltype(name_a), uint8_t>>(USF_FMT("{a}")) == 4);
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+    usf::format_to<"{port}/{host}">(str, 32, usf::arg<"host">("example"), usf::arg<"port">(port));
+    CHECK_EQ(str, "80/example");
+#endif
+}
+
+TEST_CASE("usf::resolve_arg_names")
+{
+    char fmt[32]{};
+    char str[32]{};
+
+    auto [err, span] = usf::resolve_arg_names(usf::StringSpan(fmt, 32), "{{{host}}}:{port:>5}{}",
+                                             {"host", "port"});
+    CHECK_EQ(err, usf::error::success);
+    CHECK_EQ(span.size(), 16);
+    CHECK_EQ(fmt, "{{{0}}}:{1:>5}{}");
+
+    usf::format_to(str, 32, fmt, "local", 80);
+    CHECK_EQ(str, "{local}:   80local");
+
+    CHECK_EQ(usf::resolve_arg_names(usf::StringSpan(fmt, 32), "{hots}", {"host"}).first, usf::error::arg_name);
+    CHECK_EQ(usf::resolve_arg_names(usf::StringSpan(fmt, 8), "{host}abcdef", {"host"}).first, usf::error::buf_overflow);
+}
+
 #endif // #if defined(USF_TEST_POSITIONAL_ARGS)
@@ -0,0 +1,213 @@
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_RANGES)
+
+#include <random>
+
+// ----------------------------------------------------------------------------
+// INTEGER RANGES
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, integer range")
+{
+    char str[128]{};
+
+    const uint32_t values[]{0, 7, 42, 12345678, 99999999, 100000000, 1234567890, 4294967295U};
+
+    usf::format_to(str, 128, "{}", usf::join(values, 8));
+    CHECK_EQ(str, "0, 7, 42, 12345678, 99999999, 100000000, 1234567890, 4294967295");
+
+    usf::format_to(str, 128, "{:d}", usf::join(values, 3, "|"));
+    CHECK_EQ(str, "0|7|42");
+
+    usf::format_to(str, 128, "[{}]", usf::join(values + 7, 1));
+    CHECK_EQ(str, "[4294967295]");
+
+    usf::format_to(str, 128, "[{}]", usf::join(values, 0));
+    CHECK_EQ(str, "[]");
+
+    const std::array<uint32_t, 3> array{{1, 22, 333}};
+
+    usf::format_to(str, 128, "{:*>16}", usf::join(array, ""));
+    CHECK_EQ(str, "**********122333");
+
+    usf::format_to(str, 128, "{:^16}", usf::join(array));
+    CHECK_EQ(str, "   1, 22, 333   ");
+
+    CHECK_EQ(usf::format_to(str, 128, "{:x}", usf::join(array)), ssize_t(usf::error::type_mismatch));
+    CHECK_EQ(usf::format_to(str, 128, "{:+}", usf::join(array)), ssize_t(usf::error::inv_sign));
+    CHECK_EQ(usf::format_to(str, 10,  "{}",   usf::join(array)), ssize_t(usf::error::buf_overflow));
+}
+
+TEST_CASE("usf::format_to, integer range (random values)")
+{
+    std::mt19937 rng(1234);
+
+    uint32_t values[64]{};
+    char str[1024]{};
+    char expected[1024]{};
+
+    for(int n = 0; n < 1000; ++n)
+    {
+        const auto count = static_cast<std::ptrdiff_t>(rng() % 64);
+
+        char* it = expected;
+        for(std::ptrdiff_t i = 0; i < count; ++i)
+        {
+            // Spread the values through all the possible digit counts.
+            values[i] = static_cast<uint32_t>(rng() >> (rng() % 32));
+            it += std::sprintf(it, (i == 0) ? "%u" : ";%u", values[i]);
+        }
+        *it = '\0';
+
+        usf::format_to(str, 1024, "{}", usf::join(values, count, ";"));
+        CHECK_EQ(str, expected);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// BYTE RANGES
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to, byte range hexadecimal")
+{
+    char str[128]{};
+
+    const uint8_t data[]{0xde, 0xad, 0xbe, 0xef, 0x00, 0x01, 0x7f, 0x80,
+                         0x0a, 0x1b, 0x2c, 0x3d, 0x4e, 0x5f, 0x60, 0xff, 0x42};
+
+    usf::format_to(str, 128, "{}", usf::bytes(data, 4));
+    CHECK_EQ(str, "deadbeef");
+
+    usf::format_to(str, 128, "{:X}", usf::bytes(data, 4));
+    CHECK_EQ(str, "DEADBEEF");
+
+    usf::format_to(str, 128, "{:x}", usf::bytes(data, 17));
+    CHECK_EQ(str, "deadbeef00017f800a1b2c3d4e5f60ff42");
+
+    usf::format_to(str, 128, "{:X}", usf::bytes(data, 4, ":"));
+    CHECK_EQ(str, "DE:AD:BE:EF");
+
+    usf::format_to(str, 128, "{:*^14x}", usf::bytes(data, 3, " "));
+    CHECK_EQ(str, "***de ad be***");
+
+    usf::format_to(str, 128, "[{}]", usf::bytes(data, 0));
+    CHECK_EQ(str, "[]");
+
+    CHECK_EQ(usf::format_to(str, 128, "{:d}", usf::bytes(data, 4)), ssize_t(usf::error::type_mismatch));
+    CHECK_EQ(usf::format_to(str, 128, "{:+x}", usf::bytes(data, 4)), ssize_t(usf::error::inv_sign));
+    CHECK_EQ(usf::format_to(str, 8,   "{:x}", usf::bytes(data, 4)), ssize_t(usf::error::buf_overflow));
+}
+
+TEST_CASE("usf::format_to, byte range hex dump")
+{
+    char str[512]{};
+
+    const char text[] = "Hello, world!\n\x00\x01" "Bytes";
+
+    usf::format_to(str, 512, "{}", usf::hexdump(text, 21));
+    CHECK_EQ(str, "00000000  48 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a 00 01  |Hello, world!...|\n"
+                  "00000010  42 79 74 65 73                                    |Bytes|");
+
+    usf::format_to(str, 512, "{:X}", usf::hexdump(text, 8));
+    CHECK_EQ(str, "00000000  48 65 6C 6C 6F 2C 20 77                           |Hello, w|");
+
+    usf::format_to(str, 512, "[{}]", usf::hexdump(text, 0));
+    CHECK_EQ(str, "[]");
+
+    CHECK_EQ(usf::format_to(str, 80, "{}", usf::hexdump(text, 17)), ssize_t(usf::error::buf_overflow));
+}
+
+TEST_CASE("usf::format_to, byte range hexadecimal random")
+{
+    std::mt19937 rng(29);
+
+    uint8_t data[100]{};
+    char str[256]{};
+    char expected[256]{};
+
+    for(int n = 0; n < 1000; ++n)
+    {
+        const auto size = static_cast<std::ptrdiff_t>(rng() % 100U);
+        for(auto& byte : data) {
+            byte = static_cast<uint8_t>(rng());
+        }
+
+        const bool uppercase = (n & 1) != 0;
+        char* it = expected;
+        for(std::ptrdiff_t i = 0; i < size; ++i) {
+            it += std::sprintf(it, uppercase ? "%02X" : "%02x", data[i]);
+        }
+        *it = '\0';
+
+        usf::format_to(str, 256, uppercase ? "{:X}" : "{:x}", usf::bytes(data, size));
+        CHECK_EQ(str, expected);
+    }
+}
+
+TEST_CASE("usf::format_to, byte range base64")
+{
+    char str[128]{};
+
+    const char text[] = "Many hands make light work.";
+
+    usf::format_to(str, 128, "{}", usf::base64(text, 27));
+    CHECK_EQ(str, "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu");
+
+    usf::format_to(str, 128, "{:s}", usf::base64(text, 1));
+    CHECK_EQ(str, "TQ==");
+
+    usf::format_to(str, 128, "{}", usf::base64(text, 2));
+    CHECK_EQ(str, "TWE=");
+
+    usf::format_to(str, 128, "[{:>10}]", usf::base64(text, 3));
+    CHECK_EQ(str, "[      TWFu]");
+
+    usf::format_to(str, 128, "[{:-<8}]", usf::base64(text, 0));
+    CHECK_EQ(str, "[--------]");
+
+    const uint8_t bytes[]{0xfb, 0xff, 0xbf, 0x00, 0x10, 0x83};
+    usf::format_to(str, 128, "{}", usf::base64(bytes, 6));
+    CHECK_EQ(str, "+/+/ABCD");
+
+    CHECK_EQ(usf::format_to(str, 128, "{:x}", usf::base64(text, 3)), ssize_t(usf::error::type_mismatch));
+    CHECK_EQ(usf::format_to(str, 4,   "{}",   usf::base64(text, 3)), ssize_t(usf::error::buf_overflow));
+}
+
+TEST_CASE("usf::format_to, byte range base64 random")
+{
+    static constexpr char lut[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::mt19937 rng(30);
+
+    uint8_t data[100]{};
+    char str[256]{};
+    char expected[256]{};
+
+    for(int n = 0; n < 1000; ++n)
+    {
+        const auto size = static_cast<int>(rng() % 100U);
+        for(auto& byte : data) {
+            byte = static_cast<uint8_t>(rng());
+        }
+
+        // Reference encoder, one bit at a time
+        char* it = expected;
+        for(int bit = 0; bit < size * 8; bit += 6)
+        {
+            unsigned sextet = 0;
+            for(int i = bit; i < bit + 6; ++i) {
+                const unsigned b = (i < size * 8) ? ((data[i / 8] >> (7 - i % 8)) & 1U) : 0U;
+                sextet = (sextet << 1U) | b;
+            }
+            *it++ = lut[sextet];
+        }
+        while((it - expected) % 4 != 0) {
+            *it++ = '=';
+        }
+        *it = '\0';
+
+        usf::format_to(str, 256, "{}", usf::base64(data, size));
+        CHECK_EQ(str, expected);
+    }
+}
+
+#endif // #if defined(USF_TEST_RANGES)
@@ -0,0 +1,258 @@
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_SCAN)
+
+#include <cstring>
+#include <string>
+
+static std::string to_string(const usf::StringView str)
+{
+    return std::string(str.cbegin(), str.cend());
+}
+
+template <typename T>
+static bool same_bits(const T a, const T b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+// ----------------------------------------------------------------------------
+// SCANNING
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::scan")
+{
+    SUBCASE("integers and strings")
+    {
+        uint32_t time = 0;
+        usf::StringView level("");
+        int code = 0;
+
+        auto [err, count, rest] = usf::scan("1234 [warn] 2a tail", "{} [{}] {:x}", time, level, code);
+        CHECK_EQ(err, usf::error::success);
+        CHECK_EQ(count, 3);
+        CHECK_EQ(time, 1234U);
+        CHECK_EQ(to_string(level), "warn");
+        CHECK_EQ(code, 42);
+        CHECK_EQ(to_string(rest), " tail");
+    }
+
+    SUBCASE("zero-copy strings")
+    {
+        const char* line = "key=value;next";
+        usf::StringView key(""), value(""), last("");
+
+        CHECK_EQ(usf::scan(line, "{}={};{}", key, value, last).ec, usf::error::success);
+        CHECK_EQ(key.cbegin(), line);
+        CHECK_EQ(value.cbegin(), line + 4);
+        CHECK_EQ(to_string(value), "value");
+        CHECK_EQ(to_string(last), "next");
+
+        // Followed by another field: up to the next whitespace
+        usf::StringView word(""), other("");
+        CHECK_EQ(usf::scan("hello world", "{}{}", word, other).ec, usf::error::success);
+        CHECK_EQ(to_string(word), "hello");
+        CHECK_EQ(to_string(other), " world");
+
+        // Precision: maximum size
+        CHECK_EQ(usf::scan("abcdef", "{:.3s}{}", word, other).ec, usf::error::success);
+        CHECK_EQ(to_string(word), "abc");
+        CHECK_EQ(to_string(other), "def");
+    }
+
+    SUBCASE("integer types")
+    {
+        int8_t   i8  = 0;
+        uint16_t u16 = 0;
+        int64_t  i64 = 0;
+        uint64_t u64 = 0;
+
+        CHECK_EQ(usf::scan("-128,65535,-9223372036854775808,18446744073709551615", "{},{},{},{}", i8, u16, i64, u64).ec,
+                 usf::error::success);
+        CHECK_EQ(i8, INT8_MIN);
+        CHECK_EQ(u16, UINT16_MAX);
+        CHECK_EQ(i64, INT64_MIN);
+        CHECK_EQ(u64, UINT64_MAX);
+
+        unsigned int hex = 0, oct = 0, bin = 0;
+        CHECK_EQ(usf::scan("0xBEEF 0755 0b101", "{:#x} {:o} {:#b}", hex, oct, bin).ec, usf::error::success);
+        CHECK_EQ(hex, 0xBEEFU);
+        CHECK_EQ(oct, 0755U);
+        CHECK_EQ(bin, 5U);
+
+        int positive = 0;
+        CHECK_EQ(usf::scan("+17", "{:+d}", positive).ec, usf::error::success);
+        CHECK_EQ(positive, 17);
+        CHECK_EQ(usf::scan("+17", "{}", positive).ec, usf::error::no_match);
+
+        // Out of range
+        const auto overflow = usf::scan("x=300", "x={}", i8);
+        CHECK_EQ(overflow.ec, usf::error::value_overflow);
+        CHECK_EQ(overflow.value, 0);
+    }
+
+#if !defined(USF_DISABLE_FLOAT_SUPPORT)
+    SUBCASE("floating point")
+    {
+        double x = 0;
+        float  y = 0;
+
+        CHECK_EQ(usf::scan("(-1.5e3, 0.1)", "({:e}, {})", x, y).ec, usf::error::success);
+        CHECK_UNARY(same_bits(x, -1500.0));
+        CHECK_UNARY(same_bits(y, 0.1f));
+    }
+#endif
+
+    SUBCASE("bool and char")
+    {
+        bool flag = false, bit = true;
+        char ch = 0, code = 0;
+
+        CHECK_EQ(usf::scan("true 0 c 65", "{} {:d} {} {:d}", flag, bit, ch, code).ec, usf::error::success);
+        CHECK(flag);
+        CHECK(!bit);
+        CHECK_EQ(ch, 'c');
+        CHECK_EQ(code, 'A');
+    }
+
+    SUBCASE("width")
+    {
+        // Fixed width fields, as written by the formatter
+        int year = 0, month = 0, day = 0;
+        CHECK_EQ(usf::scan("20261019", "{:4d}{:2d}{:2d}", year, month, day).ec, usf::error::success);
+        CHECK_EQ(year, 2026);
+        CHECK_EQ(month, 10);
+        CHECK_EQ(day, 19);
+
+        char str[64]{};
+        usf::StringView name("");
+        int value = 0;
+        unsigned int id = 0;
+
+        usf::format_to(str, 64, "|{:<8}|{:>6}|{:06x}|", "name", -42, 0xABCU);
+        CHECK_EQ(usf::scan(str, "|{:<8}|{:>6}|{:06x}|", name, value, id).ec, usf::error::success);
+        CHECK_EQ(to_string(name), "name");
+        CHECK_EQ(value, -42);
+        CHECK_EQ(id, 0xABCU);
+
+        CHECK_EQ(usf::scan("  0", "{:3}", value).ec, usf::error::success);
+        CHECK_EQ(value, 0);
+
+        // The value must span the whole field
+        CHECK_EQ(usf::scan(" 4x", "{:3}", value).ec, usf::error::no_match);
+        CHECK_EQ(usf::scan("12", "{:3}", value).ec, usf::error::no_match);
+    }
+
+    SUBCASE("positional arguments and escapes")
+    {
+        int a = 0, b = 0;
+        CHECK_EQ(usf::scan("{2:1}", "{{{1}:{0}}}", a, b).ec, usf::error::success);
+        CHECK_EQ(a, 1);
+        CHECK_EQ(b, 2);
+    }
+
+    SUBCASE("errors")
+    {
+        int a = 0, b = 0;
+
+        // Input not matching: the outputs before are set
+        const auto result = usf::scan("1,x", "{},{}", a, b);
+        CHECK_EQ(result.ec, usf::error::no_match);
+        CHECK_EQ(result.value, 1);
+        CHECK_EQ(a, 1);
+        CHECK_EQ(to_string(result.rest), "x");
+
+        CHECK_EQ(usf::scan("1;2", "{},{}", a, b).ec, usf::error::no_match);
+        CHECK_EQ(usf::scan("1,", "{},{}", a, b).ec, usf::error::no_match);
+        CHECK_EQ(usf::scan("ab", "abc").ec, usf::error::no_match);
+
+        // Format string errors
+        CHECK_EQ(usf::scan("1", "{:s}", a).ec, usf::error::arg_type);
+        CHECK_EQ(usf::scan("1,000", "{:,}", a).ec, usf::error::inv_format);
+        CHECK_EQ(usf::scan("1 2", "{} {}", a).ec, usf::error::arg_index_too_large);
+        CHECK_EQ(usf::scan("1}", "{}}", a).ec, usf::error::arg_enclose);
+    }
+}
+
+TEST_CASE("usf::scan, parsed format strings")
+{
+    const char* lines[] = {"12:ff ok", "7:10 overflow", "0:0 "};
+
+    SUBCASE("run time")
+    {
+        const usf::ScanFormat<> format("{}:{:x} {}");
+        REQUIRE_EQ(format.ec_error(), usf::error::success);
+
+        unsigned int a = 0, b = 0;
+        usf::StringView c("");
+
+        CHECK_EQ(usf::scan(lines[0], format, a, b, c).ec, usf::error::success);
+        CHECK_EQ(a, 12U);
+        CHECK_EQ(b, 255U);
+        CHECK_EQ(to_string(c), "ok");
+
+        CHECK_EQ(usf::scan(lines[1], format, a, b, c).ec, usf::error::success);
+        CHECK_EQ(to_string(c), "overflow");
+
+        CHECK_EQ(usf::scan(lines[2], format, a, b, c).ec, usf::error::success);
+        CHECK(c.empty());
+
+        // Not enough outputs
+        CHECK_EQ(usf::scan(lines[0], format, a, b).ec, usf::error::arg_index_too_large);
+
+        CHECK_EQ(usf::ScanFormat<>("{").ec_error(), usf::error::arg_enclose);
+        CHECK_EQ(usf::ScanFormat<2>("{}:{:x} {}").ec_error(), usf::error::buf_overflow);
+        CHECK_EQ(usf::ScanFormat<16, 2>("{}:::{}").ec_error(), usf::error::buf_overflow);
+    }
+
+    SUBCASE("compile time")
+    {
+        unsigned int a = 0, b = 0;
+        usf::StringView c("");
+
+        const auto [err, count, rest] = usf::scan(lines[0], USF_FMT("{}:{:x} {}"), a, b, c);
+        CHECK_EQ(err, usf::error::success);
+        CHECK_EQ(count, 3);
+        CHECK_EQ(a, 12U);
+        CHECK_EQ(b, 255U);
+        CHECK_EQ(to_string(c), "ok");
+        CHECK(rest.empty());
+
+        CHECK_EQ(usf::scan("12;ff ok", USF_FMT("{}:{:x} {}"), a, b, c).ec, usf::error::no_match);
+
+#if defined(USF_CPP20_STRING_TEMPLATE_ARGS)
+        CHECK_EQ(usf::scan<"{}:{:x} {}">(lines[1], a, b, c).ec, usf::error::success);
+        CHECK_EQ(to_string(c), "overflow");
+#endif
+    }
+}
+
+TEST_CASE("usf::scan, round trip")
+{
+    char str[128]{};
+
+    uint64_t value = 7;
+
+    for(int i = 0; i < 10000; ++i)
+    {
+        value = value * 6364136223846793005U + 1442695040888963407U;
+
+        const auto u = value >> (i % 64);
+        const auto s = static_cast<int32_t>(value);
+        const auto h = static_cast<uint16_t>(value >> 16);
+
+        usf::format_to(str, 128, "{} {:+d} {:#06x} [{:>10}]", u, s, h, "id");
+
+        uint64_t u2 = 0;
+        int32_t  s2 = 0;
+        uint16_t h2 = 0;
+        usf::StringView id("");
+
+        CHECK_EQ(usf::scan(str, USF_FMT("{} {:+d} {:#06x} [{:>10}]"), u2, s2, h2, id).ec, usf::error::success);
+        CHECK_EQ(u2, u);
+        CHECK_EQ(s2, s);
+        CHECK_EQ(h2, h);
+        CHECK_EQ(to_string(id), "id");
+    }
+}
+
+#endif // defined(USF_TEST_SCAN)
@@ -0,0 +1,563 @@
+
+#include "unit_tests_config.hpp"
+
+#if defined(USF_TEST_SINKS)
+
+#include <cstring>
+
+#if defined(__linux__)
+#include <usf/usf_posix.hpp>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <csignal>
+#include <thread>
+#include <vector>
+#endif
+
+static std::string gather(const usf::IoVecSpan& iov)
+{
+    std::string str;
+    for(int n = 0; n < iov.count(); ++n)
+    {
+        str.append(iov.data()[n].data, static_cast<std::size_t>(iov.data()[n].size));
+    }
+    return str;
+}
+
+// ----------------------------------------------------------------------------
+// SCATTER-GATHER OUTPUT
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::format_to_iov")
+{
+    usf::IoVec iov[8];
+    char scratch[32];
+
+    const char* fmt = "Request {} from {:>8} took {:5d} ms";
+
+    usf::IoVecSpan span(iov);
+    CHECK_EQ(usf::format_to_iov(span, usf::StringSpan(scratch, 32), fmt, 42, "client", 150), 38);
+    CHECK_EQ(gather(span), "Request 42 from   client took   150 ms");
+
+    // The literal text points into the format string
+    CHECK_EQ(span.count(), 7);
+    CHECK_EQ(static_cast<const void*>(iov[0].data), static_cast<const void*>(fmt));
+    CHECK_EQ(iov[0].size, 8);
+    CHECK_EQ(static_cast<const void*>(iov[6].data), static_cast<const void*>(fmt + 32));
+
+    // Consecutive fields are merged, escapes split the literal text
+    usf::IoVecSpan merged(iov);
+    CHECK_EQ(usf::format_to_iov(merged, usf::StringSpan(scratch, 32), "{{{}{}}}", 'a', 12), 5);
+    CHECK_EQ(gather(merged), "{a12}");
+    CHECK_EQ(merged.count(), 3);
+
+    usf::IoVecSpan named(iov);
+    usf::format_to_iov(named, usf::StringSpan(scratch, 32), "{id}:{id:x}", usf::arg("id", 255));
+    CHECK_EQ(gather(named), "255:ff");
+
+    // Errors
+    usf::IoVecSpan small(iov, 2);
+    CHECK_EQ(usf::format_to_iov(small, usf::StringSpan(scratch, 32), "a{}b{}", 1, 2), ssize_t(usf::error::buf_overflow));
+
+    usf::IoVecSpan error(iov);
+    CHECK_EQ(usf::format_to_iov(error, usf::StringSpan(scratch, 4), "{}", 12345), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(usf::format_to_iov(error, usf::StringSpan(scratch, 32), "{} }", 1), ssize_t(usf::error::arg_enclose));
+    CHECK_EQ(usf::format_to_iov(error, usf::StringSpan(scratch, 32), "{1}", 1), ssize_t(usf::error::arg_index_too_large));
+}
+
+// ----------------------------------------------------------------------------
+// FLIGHT RECORDER
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::RingSink")
+{
+    alignas(4) char storage[64];
+    char str[80];
+
+    usf::RingSink<> ring(usf::StringSpan(storage, 64), 16);
+    REQUIRE_EQ(ring.ec_error(), usf::error::success);
+    CHECK_EQ(ring.capacity(), 64);
+
+    CHECK_EQ(ring.dump(usf::StringSpan(str, 80)).second.size(), 0);
+
+    CHECK_EQ(ring.format("rec {}", 1), 5);
+    CHECK_EQ(ring.format(USF_FMT("rec {}"), 2), 5);
+    CHECK_EQ(std::string(ring.dump(usf::StringSpan(str, 80)).second.data()), "rec 1\nrec 2\n");
+
+    // Oldest records overwritten, the newest ones kept in order
+    std::string all = "rec 1\nrec 2\n";
+    for(int n = 3; n <= 20; ++n)
+    {
+        CHECK_EQ(ring.format("rec {}", n), (n < 10) ? 5 : 6);
+        all += "rec " + std::to_string(n) + "\n";
+
+        const std::string dump(ring.dump(usf::StringSpan(str, 80)).second.data());
+        CHECK_EQ(all.compare(all.size() - dump.size(), dump.size(), dump), 0);
+        CHECK_GE(dump.size(), 12U);
+    }
+    CHECK_GT(ring.overwritten(), 0U);
+
+    // Records are never split at the end of the buffer
+    int count = 0;
+    ring.for_each_record([&](usf::StringView record)
+    {
+        CHECK_EQ(std::string(record.cbegin(), static_cast<std::size_t>(record.size())).substr(0, 4), "rec ");
+        ++count;
+    });
+    CHECK_GE(count, 4);
+
+    // Records not stored (their space may be taken from the oldest ones)
+    CHECK_EQ(ring.format("{}", "a record larger than max_record"), ssize_t(usf::error::buf_overflow));
+    const std::string dump(ring.dump(usf::StringSpan(str, 80)).second.data());
+    CHECK_EQ(all.compare(all.size() - dump.size(), dump.size(), dump), 0);
+    CHECK_EQ(ring.dump(usf::StringSpan(str, 8)).first, usf::error::buf_overflow);
+
+    ring.clear();
+    CHECK_EQ(ring.dump(usf::StringSpan(str, 80)).second.size(), 0);
+
+    usf::RingSink<> small(usf::StringSpan(storage, 16), 16);
+    CHECK_EQ(small.ec_error(), usf::error::buf_overflow);
+    CHECK_EQ(small.format("x"), ssize_t(usf::error::buf_overflow));
+}
+
+#if defined(__linux__)
+TEST_CASE("usf::RingSink, multiple writers")
+{
+    std::vector<char> storage(4096);
+    usf::RingSink<true> ring(usf::StringSpan(storage.data(), 4096), 32);
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&ring, t]() noexcept
+        {
+            for(int n = 0; n < 100; ++n) { ring.format(USF_FMT("{} {:04d}"), t, n); }
+        });
+    }
+    for(auto& thread : threads) { thread.join(); }
+
+    // The records of each thread are kept in order, the last ones last
+    int last[4]{-1, -1, -1, -1};
+    ring.for_each_record([&](usf::StringView record)
+    {
+        REQUIRE_EQ(record.size(), 6);
+        const int t = record[0] - '0';
+        const int n = std::stoi(std::string(record.cbegin() + 2, 4));
+        CHECK_GT(n, last[t]);
+        last[t] = n;
+    });
+    for(int t = 0; t < 4; ++t) { CHECK_EQ(last[t], 99); }
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// MULTIPLE PRODUCERS SINK
+// ----------------------------------------------------------------------------
+TEST_CASE("usf::MpscSink")
+{
+    alignas(16) char storage[256];
+
+    usf::MpscSink sink(usf::StringSpan(storage, 256), 32);
+    REQUIRE_EQ(sink.ec_error(), usf::error::success);
+    CHECK_EQ(sink.capacity(), 256);
+
+    std::string str;
+    auto read = [&str](usf::StringView record) { str.append(record.cbegin(), static_cast<std::size_t>(record.size())) += '|'; };
+
+    CHECK_EQ(sink.poll(read), 0);
+
+    // Committed in any order, read in order up to the first not committed
+    auto [err1, first] = sink.reserve(8);
+    auto [err2, second] = sink.reserve(8);
+    REQUIRE_EQ(err1, usf::error::success);
+    REQUIRE_EQ(err2, usf::error::success);
+
+    second.span[0] = 'b';
+    sink.commit(second, 1);
+    CHECK_EQ(sink.poll(read), 0);
+
+    first.span[0] = 'a';
+    sink.commit(first, 1);
+    CHECK_EQ(sink.poll(read), 2);
+    CHECK_EQ(str, "a|b|");
+
+    // Records wrapping around the buffer end start over at its beginning
+    str.clear();
+    for(int n = 0; n < 20; ++n)
+    {
+        CHECK_EQ(sink.format("rec {}", n), (n < 10) ? 5 : 6);
+        CHECK_EQ(sink.format(USF_FMT("{:d}"), n % 10), 1);
+        sink.poll(read);
+    }
+    CHECK_EQ(str.substr(0, 24), "rec 0|0|rec 1|1|rec 2|2|");
+    CHECK_EQ(str.substr(str.size() - 9), "rec 19|9|");
+
+    // A record reserved where the previous lap left text looking like its
+    // committed header is not read before its commit
+    {
+        alignas(16) char ring[256];
+        usf::MpscSink lap(usf::StringSpan(ring, 256), 232);
+
+        // At 0, the text from 16 to 240
+        auto [err, large] = lap.reserve(224);
+        REQUIRE_EQ(err, usf::error::success);
+
+        // The record reserved at 272 (after the empty one wrapping at 240)
+        // has its header at 16: the text holds its committed position.
+        const std::uint64_t stale[2] = {272 + 1, (uint64_t(1) << 32) | 232U};
+        std::memcpy(large.span.begin(), stale, sizeof(stale));
+        lap.commit(large, 224);
+
+        str.clear();
+        CHECK_EQ(lap.poll(read), 1);
+
+        auto [err_small, small] = lap.reserve(8);
+        REQUIRE_EQ(err_small, usf::error::success);
+        CHECK_EQ(small.position, 272);
+
+        str.clear();
+        CHECK_EQ(lap.poll(read), 0);
+        CHECK_EQ(str, "");
+
+        small.span[0] = 'c';
+        lap.commit(small, 1);
+        CHECK_EQ(lap.poll(read), 1);
+        CHECK_EQ(str, "c|");
+    }
+
+    // Errors
+    str.clear();
+    CHECK_EQ(sink.format("{}", "a record larger than the max_record"), ssize_t(usf::error::buf_overflow));
+    CHECK_EQ(sink.reserve(512).first, usf::error::buf_overflow);
+    CHECK_EQ(sink.poll(read), 0);
+    CHECK_EQ(str, "");
+
+    usf::MpscSink small(usf::StringSpan(storage, 32), 32);
+    CHECK_EQ(small.ec_error(), usf::error::buf_overflow);
+    CHECK_EQ(small.poll(read), 0);
+}
+
+#if defined(__linux__)
+TEST_CASE("usf::MpscSink, multiple producers")
+{
+    std::vector<char> storage(4096);
+    usf::MpscSink sink(usf::StringSpan(storage.data(), 4096), 32);
+
+    constexpr int kThreads = 8;
+    constexpr int kRecords = 5000;
+
+    std::atomic<int> running{kThreads};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&sink, &running, t]() noexcept
+        {
+            for(int n = 0; n < kRecords; ++n) { sink.format(USF_FMT("{} {:05d}"), t, n); }
+            --running;
+        });
+    }
+
+    // Consumer, concurrently with the producers
+    int last[kThreads]{-1, -1, -1, -1, -1, -1, -1, -1};
+    int count = 0;
+    auto read = [&](usf::StringView record)
+    {
+        REQUIRE_EQ(record.size(), 7);
+        const int t = record[0] - '0';
+        const int n = std::stoi(std::string(record.cbegin() + 2, 5));
+        CHECK_EQ(n, last[t] + 1);
+        last[t] = n;
+        ++count;
+    };
+
+    while(running > 0) { sink.poll(read); }
+    for(auto& thread : threads) { thread.join(); }
+    sink.poll(read);
+
+    CHECK_EQ(count, kThreads * kRecords);
+}
+#endif
+
+#if defined(__linux__)
+TEST_CASE("usf::posix::WritevSink")
+{
+    int fds[2];
+    REQUIRE_EQ(pipe(fds), 0);
+
+    usf::posix::WritevSink<8, 64> sink(fds[1]);
+
+    CHECK_EQ(sink.format("[{:04d}] {}: {}\n", 7, "net", "link up"), 20);
+
+    // More pieces than a single writev() batch
+    usf::IoVec iov[40];
+    std::string expected;
+    for(int n = 0; n < 40; ++n)
+    {
+        iov[n] = usf::IoVec{"0123456789" + n % 10, 1};
+        expected += static_cast<char>('0' + n % 10);
+    }
+    CHECK_EQ(usf::posix::write_iov(fds[1], iov, 40), 40);
+
+    close(fds[1]);
+
+    char str[128]{};
+    std::ptrdiff_t size = 0;
+    for(ssize_t n = 0; (n = read(fds[0], str + size, sizeof(str) - 1 - static_cast<std::size_t>(size))) > 0; ) { size += n; }
+    close(fds[0]);
+
+    CHECK_EQ(std::string(str, static_cast<std::size_t>(size)), "[0007] net: link up\n" + expected);
+
+    CHECK_EQ(sink.format("{}", 1), ssize_t(usf::error::io_error));
+}
+
+static std::vector<std::string> read_back(const char* path)
+{
+    std::vector<std::string> records;
+
+    usf::posix::MmapSink sink;
+    REQUIRE_EQ(sink.open(path, 1 << 20, 4096), usf::error::success);
+    sink.for_each_record([&](usf::StringView record) {
+        records.emplace_back(record.data(), static_cast<std::size_t>(record.size()));
+    });
+    return records;
+}
+
+TEST_CASE("usf::posix::MmapSink")
+{
+    char path[] = "/tmp/usf_mmap_sink_XXXXXX";
+    const int fd = mkstemp(path);
+    REQUIRE(fd >= 0);
+    close(fd);
+
+    {
+        usf::posix::MmapSink sink;
+        REQUIRE_EQ(sink.open(path, 1 << 20, 4096, 64), usf::error::success);
+
+        CHECK_EQ(sink.format("boot {} {:x}", "ok", 255), 10);
+        CHECK_EQ(sink.format(USF_FMT("id={:08d}"), 42), 11);
+
+        // The records take their formatted size, not the reservation
+        CHECK_EQ(sink.committed(), 2 * (8 + 16U));
+
+        // Reserve-then-commit
+        auto [err, record] = sink.reserve(16);
+        REQUIRE_EQ(err, usf::error::success);
+        auto [format_err, str] = usf::basic_format_to(record.span, "manual");
+        CHECK_EQ(format_err, usf::error::success);
+        sink.commit(record, str.size());
+
+        // Too long for a record: committed empty, skipped at readback
+        CHECK_EQ(sink.format("{:>100}", 1), ssize_t(usf::error::buf_overflow));
+    }
+
+    CHECK_EQ(read_back(path), std::vector<std::string>{"boot ok ff", "id=00000042", "manual"});
+
+    // Appends to the existing records, from several threads
+    {
+        usf::posix::MmapSink sink;
+        REQUIRE_EQ(sink.open(path, 1 << 20, 4096, 32), usf::error::success);
+
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&sink, t]() noexcept {
+                for(int n = 0; n < 1000; ++n) { static_cast<void>(sink.format("t{} r{}", t, n)); }
+            });
+        }
+        for(auto& thread : threads) { thread.join(); }
+    }
+
+    const auto records = read_back(path);
+    REQUIRE_EQ(records.size(), 4003U);
+
+    int next[4]{};
+    for(std::size_t n = 3; n < records.size(); ++n)
+    {
+        const int t = records[n][1] - '0';
+        REQUIRE((t >= 0 && t < 4));
+        CHECK_EQ(records[n], "t" + std::to_string(t) + " r" + std::to_string(next[t]++));
+    }
+
+    // Crash with a record reserved but not committed: the records committed
+    // before read back.
+    const pid_t pid = fork();
+    REQUIRE(pid >= 0);
+    if(pid == 0)
+    {
+        usf::posix::MmapSink sink;
+        if(sink.open(path, 1 << 20, 4096) != usf::error::success) { _exit(1); }
+        static_cast<void>(sink.format("last"));
+        static_cast<void>(sink.reserve(32));
+        static_cast<void>(sink.format("lost"));
+        _exit(0);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    CHECK_EQ(status, 0);
+
+    const auto recovered = read_back(path);
+    REQUIRE_EQ(recovered.size(), 4004U);
+    CHECK_EQ(recovered.back(), "last");
+
+    unlink(path);
+}
+
+TEST_CASE("usf::posix::MmapSink, file growth failure")
+{
+    char path[] = "/tmp/usf_mmap_grow_XXXXXX";
+    const int fd = mkstemp(path);
+    REQUIRE(fd >= 0);
+    close(fd);
+
+    // The file size limit makes grow() fail: the records formatted after
+    // the limit is lifted are committed (no gap left by the failed one).
+    const pid_t pid = fork();
+    REQUIRE(pid >= 0);
+    if(pid == 0)
+    {
+        rlimit limit{};
+        if(getrlimit(RLIMIT_FSIZE, &limit) != 0) { _exit(1); }
+
+        const rlimit small{8192, limit.rlim_max};
+        std::signal(SIGXFSZ, SIG_IGN);
+        if(setrlimit(RLIMIT_FSIZE, &small) != 0) { _exit(1); }
+
+        usf::posix::MmapSink sink;
+        if(sink.open(path, 1 << 20, 4096, 8) != usf::error::success) { _exit(1); }
+
+        int n = 0;
+        while(sink.format("r{:04d}", n) == 5) { ++n; }
+        if(n == 0 || sink.format("r{:04d}", n) != ssize_t(usf::error::io_error)) { _exit(2); }
+
+        if(setrlimit(RLIMIT_FSIZE, &limit) != 0) { _exit(1); }
+        if(sink.format("last") != 4) { _exit(3); }
+        _exit(0);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    CHECK_EQ(status, 0);
+
+    const auto records = read_back(path);
+    REQUIRE_GT(records.size(), 1U);
+    CHECK_EQ(records.back(), "last");
+    char expected[8]{};
+    for(std::size_t n = 0; n + 1 < records.size(); ++n)
+    {
+        usf::format_to(expected, 8, "r{:04d}", n);
+        CHECK_EQ(records[n], std::string(expected));
+    }
+
+    unlink(path);
+}
+
+static std::string read_all(const int fd)
+{
+    std::string str;
+    char chunk[4096];
+
+    for(ssize_t n = 0; (n = read(fd, chunk, sizeof(chunk))) > 0; ) { str.append(chunk, static_cast<std::size_t>(n)); }
+    return str;
+}
+
+TEST_CASE("usf::posix::AsyncFileSink")
+{
+    char path[] = "/tmp/usf_async_sink_XXXXXX";
+    const int fd = mkstemp(path);
+    REQUIRE(fd >= 0);
+
+    // Blocking mode, several formatting threads
+    {
+        usf::posix::AsyncFileConfig config;
+        config.buffer_size     = 1024;
+        config.buffer_count    = 3;
+        config.flush_threshold = 768;
+
+        usf::posix::AsyncFileSink sink(fd, config);
+
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&sink, t]() noexcept {
+                for(int n = 0; n < 1000; ++n) { static_cast<void>(sink.format("t{} r{}\n", t, n)); }
+            });
+        }
+        for(auto& thread : threads) { thread.join(); }
+
+        CHECK_EQ(sink.format(USF_FMT("{}"), std::string(2000, 'x')), ssize_t(usf::error::buf_overflow));
+        CHECK_EQ(sink.flush(), usf::error::success);
+        CHECK_EQ(sink.dropped(), 0U);
+    }
+
+    lseek(fd, 0, SEEK_SET);
+    const std::string log = read_all(fd);
+
+    int next[4]{};
+    int lines = 0;
+    for(std::size_t begin = 0, end = 0; (end = log.find('\n', begin)) != std::string::npos; begin = end + 1, ++lines)
+    {
+        const std::string line = log.substr(begin, end - begin);
+        const int t = line[1] - '0';
+        REQUIRE((t >= 0 && t < 4));
+        CHECK_EQ(line, "t" + std::to_string(t) + " r" + std::to_string(next[t]++));
+    }
+    CHECK_EQ(lines, 4000);
+
+    // Partially filled buffers are flushed at the flush interval
+    {
+        usf::posix::AsyncFileConfig config;
+        config.flush_interval = std::chrono::milliseconds(10);
+
+        usf::posix::AsyncFileSink sink(fd, config);
+        CHECK_EQ(sink.format("tick"), 4);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        CHECK_EQ(lseek(fd, 0, SEEK_END), static_cast<off_t>(log.size() + 4));
+    }
+
+    close(fd);
+    unlink(path);
+}
+
+TEST_CASE("usf::posix::AsyncFileSink, backpressure")
+{
+    int fds[2];
+    REQUIRE_EQ(pipe(fds), 0);
+    fcntl(fds[1], F_SETPIPE_SZ, 4096);
+
+    std::string expected;
+    std::string received;
+    std::thread reader;
+
+    {
+        usf::posix::AsyncFileConfig config;
+        config.buffer_size     = 1024;
+        config.flush_threshold = 1024;
+        config.overflow        = usf::posix::AsyncFileConfig::Overflow::kDrop;
+
+        usf::posix::AsyncFileSink sink(fds[1], config);
+
+        // Nobody reads the pipe: the flusher blocks and the buffers fill up.
+        ssize_t result = 0;
+        for(int n = 0; n < 10000 && result >= 0; ++n)
+        {
+            result = sink.format("record {:04d}\n", n);
+            if(result > 0) { expected += "record " + std::string(4 - std::to_string(n).size(), '0') + std::to_string(n) + "\n"; }
+        }
+
+        CHECK_EQ(result, ssize_t(usf::error::backpressure));
+        CHECK_EQ(sink.dropped(), 1U);
+
+        reader = std::thread([&received, &fds]() noexcept { received = read_all(fds[0]); });
+    }
+    close(fds[1]);
+    reader.join();
+    close(fds[0]);
+
+    CHECK_EQ(received, expected);
+}
+#endif
+
+#endif // #if defined(USF_TEST_SINKS)